@@ -890,6 +890,14 @@
   // and processor overload (too many expensive sqrt calls).
   #define DELTA_SEGMENTS_PER_SECOND 200
 
+  // Use fewer segments where the towers move nearly linearly, such as near the
+  // center, keeping each tower within this distance of its true position.
+  //#define DELTA_SEGMENT_DEVIATION 0.005 // (mm)
+
+  // Precompute the tower geometry for forward kinematics (M114, probing,
+  // endstop hits) and reuse the last result when the carriages haven't moved.
+  //#define DELTA_CACHED_FK
+
   // After homing move down to a height where XY movement is unconstrained
   //#define DELTA_HOME_TO_SAFE_ZONE
 
@@ -906,6 +914,12 @@
   #if ENABLED(DELTA_AUTO_CALIBRATION)
     // set the default number of probe points : n*n (1 -> 7)
     #define DELTA_CALIBRATION_DEFAULT_POINTS 4
+
+    // G33 L: Probe once and fit endstops, radius, diagonal rod and tower angles together
+    //#define DELTA_CALIBRATION_LEAST_SQUARES
+    #if ENABLED(DELTA_CALIBRATION_LEAST_SQUARES)
+      #define DELTA_CALIBRATION_LSQ_POINTS 12   // Points on the outer circle. Half as many on the inner circle, plus the center.
+    #endif
   #endif
 
   #if EITHER(DELTA_AUTO_CALIBRATION, DELTA_CALIBRATION_MENU)
@@ -956,6 +970,14 @@
   // If movement is choppy try lowering this value
   #define SCARA_SEGMENTS_PER_SECOND 200
 
+  // Use fewer segments where the arm joints move nearly linearly, keeping
+  // the arm end within about this distance of its true path.
+  //#define SCARA_SEGMENT_DEVIATION 0.005 // (mm)
+
+  // Polynomial atan2/acos in the inverse kinematics. Faster on boards without
+  // an FPU, with under 0.0001° of angle error.
+  //#define SCARA_FAST_TRIG
+
   // Length of inner and outer support arms. Measure arm lengths precisely.
   #define SCARA_LINKAGE_1 150       // (mm)
   #define SCARA_LINKAGE_2 150       // (mm)
@@ -993,6 +1015,14 @@
   #define DEBUG_ROBOT_KINEMATICS
   #define ROBOT_SEGMENTS_PER_SECOND 200
 
+  // Use fewer segments where the arm joints move nearly linearly, keeping
+  // the arm end within about this distance of its true path.
+  //#define SCARA_SEGMENT_DEVIATION 0.005 // (mm)
+
+  // Polynomial atan2/acos in the inverse kinematics. Faster on boards without
+  // an FPU, with under 0.0001° of angle error.
+  //#define SCARA_FAST_TRIG
+
   // Length of inner and outer support arms. Measure arm lengths precisely.
   #define ROBOT_LINKAGE_1 120       // (mm)
   #define ROBOT_LINKAGE_2 120       // (mm)
@@ -1262,8 +1292,15 @@
  * curve to move acceleration, producing much smoother direction changes.
  *
  * See https://github.com/synthetos/TinyG/wiki/Jerk-Controlled-Motion-Explained
+ *
+ * With S_CURVE_JERK_LIMIT the planner also picks entry and exit speeds that the
+ * curves can reach without going over the maximum acceleration or jerk.
  */
 //#define S_CURVE_ACCELERATION  // Enabled
+#if ENABLED(S_CURVE_ACCELERATION)
+  //#define S_CURVE_JERK_LIMIT  // Plan jerk-limited ramps (for 32-bit boards)
+  #define S_CURVE_MAX_JERK 200000 // (mm/s³) Maximum jerk of a ramp with S_CURVE_JERK_LIMIT
+#endif
 
 //===========================================================================
 //============================= Z Probe Options =============================
@@ -1908,6 +1945,17 @@
  */
 //#define BD_SENSOR
 
+#if ENABLED(BD_SENSOR)
+  // G29 scans the grid rows at constant speed, sampling the sensor on the fly,
+  // instead of stopping at each point. Requires AUTO_BED_LEVELING_BILINEAR.
+  // Not compatible with STEP_EVENT_QUEUE, which runs the stepper counts ahead of the motors.
+  //#define BD_SENSOR_FLYING_SCAN
+  #if ENABLED(BD_SENSOR_FLYING_SCAN)
+    #define BD_SENSOR_SCAN_FEEDRATE 3000  // (mm/min) Speed along each row
+    #define BD_SENSOR_SCAN_INTERVAL    5  // (ms) Time between sensor samples
+  #endif
+#endif
+
 /**
  * Enable detailed logging of G28, G29, M48, etc.
  * Turn on with the command 'M111 S32'.
@@ -1935,6 +1983,17 @@
   #define SEGMENT_LEVELED_MOVES
   #define LEVELED_SEGMENT_LENGTH 5.0 // (mm) Length of all segments (except the last one)
 
+  /**
+   * Probe only the mesh points under the next print and keep the rest of the
+   * stored mesh. Set the print area with 'M555 X Y W H' or let an SD file set
+   * it with ;MINX: ;MINY: ;MAXX: ;MAXY: lines in its header (as Cura writes).
+   * The next G29 (or G29 P1 with UBL) uses the print area.
+   */
+  //#define ADAPTIVE_MESH
+  #if ENABLED(ADAPTIVE_MESH)
+    #define ADAPTIVE_MESH_MARGIN 5  // (mm) Also probe this far around the print area
+  #endif
+
   /**
    * Enable the G26 Mesh Validation Pattern tool.
    */
@@ -1960,6 +2019,10 @@
   // Probe along the Y axis, advancing X after each column
   //#define PROBE_Y_FIRST
 
+  // Probe the grid in a short-travel order (nearest neighbor refined by 2-opt)
+  // instead of zig-zag. Saves the most when points are skipped, as on a round bed.
+  //#define ABL_PROBE_TOUR
+
   #if ENABLED(AUTO_BED_LEVELING_BILINEAR)
 
     // Beyond the probed grid, continue the implied tilt?
@@ -1976,6 +2039,12 @@
       #define BILINEAR_SUBDIVISIONS 3
     #endif
 
+    //
+    // Interpolate with bicubic (Catmull-Rom) patches over the probed grid.
+    // As smooth as ABL_BILINEAR_SUBDIVISION without the extra grid in RAM.
+    //
+    //#define ABL_BILINEAR_BICUBIC
+
   #endif
 
 #elif ENABLED(AUTO_BED_LEVELING_UBL)
@@ -2000,6 +2069,13 @@
 
   //#define UBL_MESH_WIZARD         // Run several commands in a row to get a complete mesh
 
+  // Keep the interpolation coefficients of recently used mesh cells, so
+  // segmented moves and Z correction skip the per-cell setup
+  //#define UBL_CELL_CACHE
+  #if ENABLED(UBL_CELL_CACHE)
+    #define UBL_CELL_CACHE_SIZE 4   // Number of cells. A power of 2.
+  #endif
+
 #elif ENABLED(MESH_BED_LEVELING)
 
   //===========================================================================
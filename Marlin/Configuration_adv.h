@@ -1111,6 +1111,89 @@
   #define XY_FREQUENCY_MIN_PERCENT 5 // (percent) Minimum FR percentage to apply. Set with M201 G<min%>.
 #endif
 
+/**
+ * Input Shaping -- EXPERIMENTAL
+ *
+ * Cancel ringing on the X and/or Y steppers by splitting each step into
+ * delayed, weighted copies (ZV, ZVD, MZV, or EI shapers).
+ *
+ * The echo buffer uses a lot of SRAM. Its size is calculated from the lowest
+ * SHAPING_FREQ_[XY], DEFAULT_AXIS_STEPS_PER_UNIT and DEFAULT_MAX_FEEDRATE.
+ * Override with SHAPING_MIN_FREQ and/or SHAPING_MAX_STEPRATE. If the buffer
+ * overflows at runtime the excess steps are issued unshaped.
+ *
+ * Tune with M593 [X] [Y] F<frequency> D<zeta> T<type>:
+ *
+ *  F<frequency>  (Hz) Resonant frequency. 0 disables shaping for the axis.
+ *  D<zeta>       Damping ratio, from 0 (no damping) to 0.99.
+ *  T<type>       Shaper type: 0=ZV 1=ZVD 2=MZV 3=EI
+ *  X / Y         Apply only to the given axes. Default is all shaped axes.
+ */
+//#define INPUT_SHAPING_X
+//#define INPUT_SHAPING_Y
+#if EITHER(INPUT_SHAPING_X, INPUT_SHAPING_Y)
+  #if ENABLED(INPUT_SHAPING_X)
+    #define SHAPING_FREQ_X  40          // (Hz) The default dominant resonant frequency on the X axis.
+    #define SHAPING_ZETA_X  0.15f       // Damping ratio of the X axis (range: 0.0 = no damping to 0.99).
+    #define SHAPING_TYPE_X  SHAPER_ZV   // SHAPER_ZV, SHAPER_ZVD, SHAPER_MZV, or SHAPER_EI
+  #endif
+  #if ENABLED(INPUT_SHAPING_Y)
+    #define SHAPING_FREQ_Y  40          // (Hz) The default dominant resonant frequency on the Y axis.
+    #define SHAPING_ZETA_Y  0.15f       // Damping ratio of the Y axis (range: 0.0 = no damping to 0.99).
+    #define SHAPING_TYPE_Y  SHAPER_ZV   // SHAPER_ZV, SHAPER_ZVD, SHAPER_MZV, or SHAPER_EI
+  #endif
+  //#define SHAPING_MIN_FREQ  20        // By default the minimum of the shaping frequencies. Override to affect SRAM usage.
+  //#define SHAPING_MAX_STEPRATE 10000  // By default the maximum step rate of each shaped axis. Override to affect SRAM usage.
+#endif
+
+/**
+ * Fixed-Time Motion -- EXPERIMENTAL
+ *
+ * An alternative motion engine. Planner blocks are sampled at a fixed rate
+ * in the main loop and converted to a buffer of step commands, which the
+ * Stepper ISR plays back at a fixed rate with no per-block calculations.
+ *
+ * The trapezoid generator is still used for homing and probing, since it
+ * is the only engine that checks endstops. LIN_ADVANCE, S-Curve and Input
+ * Shaping only apply to the trapezoid generator.
+ *
+ * FTM_PRESSURE_ADVANCE applies the LIN_ADVANCE K factor (M900 K) as pressure
+ * advance in the sampled E target: E leads by K times the E velocity averaged
+ * over FTM_PA_SMOOTH_TIME. The advance goes out with the other steps, so there
+ * is no extra E ISR and no acceleration limit for the advance. All axes are
+ * delayed by half the smoothing time.
+ *
+ * M493 S<1|0> to enable or disable Fixed-Time Motion.
+ */
+//#define FT_MOTION
+#if ENABLED(FT_MOTION)
+  #define FTM_DEFAULT_ACTIVE false  // Use Fixed-Time Motion by default
+  #define FTM_FS              1000  // (Hz) Trajectory sampling rate
+  #define FTM_STEPPER_FS     20000  // (Hz) Stepper ISR rate. Also the maximum step rate of any axis.
+  #define FTM_BUFFER_SIZE     2000  // Step commands to buffer (each one 1/FTM_STEPPER_FS seconds)
+  //#define FTM_PRESSURE_ADVANCE        // Smoothed pressure advance with the LIN_ADVANCE K factor. Requires LIN_ADVANCE.
+  #if ENABLED(FTM_PRESSURE_ADVANCE)
+    #define FTM_PA_SMOOTH_TIME  0.04  // (s) Time to average the E velocity over
+  #endif
+#endif
+
+/**
+ * Step Event Queue
+ *
+ * Work out step timing ahead of the Stepper ISR in the main loop and queue
+ * the results as timed step events. The Stepper ISR only sets DIR and STEP
+ * pins when an event is due, so a costly block setup can't delay the steps
+ * around it and step rates can go higher. If the main loop falls behind the
+ * Stepper ISR computes the next steps itself, as usual.
+ *
+ * While endstops or the probe are enabled steps are computed just in time.
+ * Reported stepper positions run ahead of the motors by the queued steps.
+ */
+//#define STEP_EVENT_QUEUE
+#if ENABLED(STEP_EVENT_QUEUE)
+  #define STEP_EVENT_QUEUE_SIZE 512 // Step events to compute ahead. (Power of 2)
+#endif
+
 // Minimum planner junction speed. Sets the default minimum speed the planner plans for at the end
 // of the buffer and all stops. This should not be much greater than zero and should only be changed
 // if unwanted behavior is observed on a user's machine when running at very slow speeds.
@@ -1488,6 +1571,27 @@
 
   #define SD_PROCEDURE_DEPTH 1              // Increase if you need more nested M32 calls
 
+  /**
+   * Read the printed file a 512-byte block at a time into a RAM buffer instead of
+   * fetching every character through the FAT layer. The next block is read while
+   * the command queue is full, so the queue doesn't wait on the SD card.
+   */
+  //#define SD_READ_AHEAD
+  #if ENABLED(SD_READ_AHEAD)
+    #define SD_READ_AHEAD_BLOCKS 2          // Blocks to buffer (power of 2). 2 = double-buffered.
+  #endif
+
+  /**
+   * Keep the most recently used FAT, folder, and file blocks in RAM (512 bytes each)
+   * instead of just one, writing changed blocks to the card only when replaced or synced.
+   * FAT blocks are cached apart so listing folders and reading files won't push them out.
+   */
+  //#define SD_BLOCK_CACHE
+  #if ENABLED(SD_BLOCK_CACHE)
+    #define SD_CACHE_FAT_BLOCKS  2          // FAT blocks to cache
+    #define SD_CACHE_DATA_BLOCKS 4          // Folder and file blocks to cache
+  #endif
+
   #define SD_FINISHED_STEPPERRELEASE true   // Disable steppers when SD Print is finished
   #define SD_FINISHED_RELEASECOMMAND "M84"  // Use "M84XYE" to keep Z enabled so your bed stays in place
 
@@ -2149,6 +2253,15 @@
   #define OPTIMIZED_MESH_STORAGE  // Store mesh with less precision to save EEPROM space
 #endif
 
+/**
+ * Hold the mesh in RAM as whole microns (int16) instead of float, in half
+ * the space, for bigger grids on boards with little RAM. Z is limited to
+ * +/-32.766mm. UBL mesh slots are saved and loaded without conversion.
+ */
+#if EITHER(AUTO_BED_LEVELING_BILINEAR, AUTO_BED_LEVELING_UBL)
+  //#define COMPACT_MESH_Z
+#endif
+
 /**
  * Repeatedly attempt G29 leveling until it succeeds.
  * Stop after G29_MAX_RETRIES attempts.
@@ -2252,10 +2365,56 @@
   #define N_ARC_CORRECTION       25   // Number of interpolated segments between corrections
   #define ARC_P_CIRCLES             // Enable the 'P' parameter to specify complete circles  // Enabled
   //#define SF_ARC_FIX                // Enable only if using SkeinForge with "Arc Point" fillet procedure
+  //#define NATIVE_ARCS               // With FT_MOTION active, trace each arc as a single planner block
 #endif
 
 // G5 Bézier Curve Support with XYZE destination and IJPQ offsets
 //#define BEZIER_CURVE_SUPPORT        // Requires ~2666 bytes
+#if ENABLED(BEZIER_CURVE_SUPPORT)
+  #define BEZIER_MAX_DEVIATION 0.05   // (mm) Greatest distance allowed between the curve and its segments
+#endif
+
+/**
+ * G64 Path Blending
+ *
+ * Round off the corner between consecutive G0/G1 lines with an arc that
+ * stays within a given tolerance of the programmed path. The arc radius is
+ * passed to the planner so the machine can hold speed through the corner,
+ * limited only by the centripetal acceleration.
+ *
+ *   G64 P<mm> - Blend corners within <mm> of the path. (P0 for exact path.)
+ *   G61       - Exact path. (Use 'G64 P0' with SAVED_POSITIONS.)
+ *
+ * Requires Junction Deviation. Each line is held back until the next one
+ * arrives, so blending is off at startup and must be enabled with G64.
+ */
+//#define PATH_BLENDING
+#if ENABLED(PATH_BLENDING)
+  #define PATH_BLENDING_TOLERANCE 0.05  // (mm) Default tolerance for 'G64' with no 'P'
+#endif
+
+/**
+ * Segment Coalescing
+ *
+ * Merge runs of very short G0/G1 moves that follow a straight line into a
+ * single planner move. Fewer, longer blocks keep the planner buffer from
+ * starving at high speed on finely tessellated models.
+ *
+ * Moves are merged when they have the same feedrate, the same extrusion
+ * per mm (within COALESCE_E_RATIO), and every joint lies within the
+ * tolerance of the merged line. Any other command sends the merged move
+ * to the planner first.
+ *
+ *   M494 S<0|1> T<mm> - Enable/disable and set the tolerance. 'M494 R' resets the merged count.
+ */
+//#define SEGMENT_COALESCING
+#if ENABLED(SEGMENT_COALESCING)
+  #define COALESCE_DEFAULT_ENABLED  true  // Enabled at startup (and with M502)
+  #define COALESCE_TOLERANCE      0.005   // (mm) Maximum distance of a joint from the merged line
+  #define COALESCE_E_RATIO         0.02   // Maximum change in extrusion per mm, as a fraction
+  #define COALESCE_MAX_SEGMENT_MM   1.0   // (mm) Only merge moves shorter than this
+  #define COALESCE_MAX_SEGMENTS      16   // Maximum number of moves merged into one
+#endif
 
 #if EITHER(ARC_SUPPORT, BEZIER_CURVE_SUPPORT)
   //#define CNC_WORKSPACE_PLANES      // Allow G2/G3/G5 to operate in XY, ZX, or YZ planes
@@ -2351,6 +2510,24 @@
   #define BLOCK_BUFFER_SIZE 16
 #endif
 
+/**
+ * Compact Planner Blocks
+ *
+ * Store step counts in 16 bits and overlap the move data with the sync
+ * position so each planner block takes less RAM. Moves over 61440 steps
+ * (30720 for Core / Markforged) are split into equal parts to fit.
+ * This saves 12 bytes per block, e.g., 80 to 68 bytes on a 32-bit build
+ * with LIN_ADVANCE. Use the saved RAM for a bigger BLOCK_BUFFER_SIZE.
+ * The size of the block buffer is reported at the end of the build.
+ */
+//#define COMPACT_PLANNER_BLOCKS
+
+/**
+ * Count the planner pass kernels and trapezoid calculations run for
+ * each queued block. Use 'M495' to report and 'M495 R' to reset.
+ */
+//#define PLANNER_KERNEL_STATS
+
 // @section serial
 
 // The ASCII buffer for serial input
@@ -3754,6 +3931,37 @@
      * A non-zero value activates Volume-based Extrusion Limiting.
      */
     #define DEFAULT_VOLUMETRIC_EXTRUDER_LIMIT 0.00      // (mm^3/sec)
+
+    /**
+     * Scale the volumetric limit with the melt capacity of the hotend.
+     * The limit is set for VOLUMETRIC_LIMIT_REF_TEMP and changes in proportion
+     * to the nozzle temperature above VOLUMETRIC_LIMIT_MELT_TEMP. With PID or
+     * MPC it is also lowered as the heater runs out of power headroom.
+     * Moves are only slowed down when they would exceed the scaled limit.
+     */
+    //#define VOLUMETRIC_LIMIT_BY_TEMP
+    #if ENABLED(VOLUMETRIC_LIMIT_BY_TEMP)
+      #define VOLUMETRIC_LIMIT_REF_TEMP   210           // (°C) Temperature the limit applies to
+      #define VOLUMETRIC_LIMIT_MELT_TEMP  170           // (°C) Temperature with no melt capacity
+      #define VOLUMETRIC_LIMIT_HEADROOM   0.15          // Lower the limit when less than this fraction of heater power is left
+      #define VOLUMETRIC_LIMIT_MIN_SCALE  0.25          // Smallest fraction of the limit
+      #define VOLUMETRIC_LIMIT_MAX_SCALE  1.5           // Largest multiple of the limit
+    #endif
+  #endif
+
+  /**
+   * Nonlinear Extrusion
+   * Hotends fall behind at high flow, so scale each extruding move by
+   * (1 + A * Q + B * Q^2), where Q is the flow requested by the move in
+   * mm^3/sec. With VOLUMETRIC_EXTRUDER_LIMIT Q is capped at the limit, and
+   * the limit applies to the requested flow, not to the compensated flow.
+   * Use 'M592 [T<extruder>] A<linear> B<quadratic>' to set and 'M502' to reset.
+   */
+  //#define NONLINEAR_EXTRUSION
+  #if ENABLED(NONLINEAR_EXTRUSION)
+    #define NONLINEAR_EXTRUSION_DEFAULT_A 0.0           // (per mm^3/sec)
+    #define NONLINEAR_EXTRUSION_DEFAULT_B 0.0           // (per (mm^3/sec)^2)
+    #define NONLINEAR_EXTRUSION_MAX       1.5           // Largest E multiplier (smallest is 1/MAX)
   #endif
 #endif
 
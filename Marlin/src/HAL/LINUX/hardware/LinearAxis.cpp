@@ -26,12 +26,17 @@
 #include "Clock.h"
 #include "LinearAxis.h"
 
+FILE *LinearAxis::step_log = nullptr;
+LinearAxis::StepRecord LinearAxis::step_records[step_records_size];
+std::atomic<std::size_t> LinearAxis::step_records_head{0}, LinearAxis::step_records_tail{0};
+
 LinearAxis::LinearAxis(pin_type enable, pin_type dir, pin_type step, pin_type end_min, pin_type end_max) {
   enable_pin = enable;
   dir_pin = dir;
   step_pin = step;
   min_pin = end_min;
   max_pin = end_max;
+  label = '?';
 
   min_position = 50;
   max_position = (200*80) + min_position;
@@ -50,11 +55,31 @@ void LinearAxis::update() {
 
 }
 
+void LinearAxis::flush_step_log() {
+  if (!step_log) return;
+  const std::size_t head = step_records_head.load(std::memory_order_acquire);
+  std::size_t tail = step_records_tail.load(std::memory_order_relaxed);
+  for (; tail != head; tail = (tail + 1) % step_records_size) {
+    const StepRecord &rec = step_records[tail];
+    fprintf(step_log, "%llu, %c, %d\n", (unsigned long long)rec.timestamp, rec.label, rec.position);
+  }
+  step_records_tail.store(tail, std::memory_order_release);
+  fflush(step_log);
+}
+
 void LinearAxis::interrupt(GpioEvent ev) {
   if (ev.pin_id == step_pin && !Gpio::pin_map[enable_pin].value) {
     if (ev.event == GpioEvent::RISE) {
       last_update = ev.timestamp;
       position += -1 + 2 * Gpio::pin_map[dir_pin].value;
+      if (step_log) {
+        const std::size_t head = step_records_head.load(std::memory_order_relaxed),
+                          next = (head + 1) % step_records_size;
+        if (next != step_records_tail.load(std::memory_order_acquire)) {
+          step_records[head] = { ev.timestamp, label, position };
+          step_records_head.store(next, std::memory_order_release);
+        }
+      }
       Gpio::pin_map[min_pin].value = (position < min_position);
       //Gpio::pin_map[max_pin].value = (position > max_position);
       //if (position < min_position) printf("axis(%d) endstop : pos: %d, mm: %f, min: %d\n", step_pin, position, position / 80.0, Gpio::pin_map[min_pin].value);
@@ -21,7 +21,9 @@
  */
 #pragma once
 
+#include <atomic>
 #include <chrono>
+#include <stdio.h>
 #include "Gpio.h"
 
 class LinearAxis: public Peripheral {
@@ -42,4 +44,16 @@ public:
   int32_t max_position;
   uint64_t last_update;
 
+  char label;                 // Axis name for the step log
+  static FILE *step_log;      // If set, log every step as "nanos, axis, position"
+  static void flush_step_log();
+
+private:
+  // Steps are logged to memory in the ISR and written out by the simulation thread.
+  // The head is published after its record, so the other thread never sees a partial one.
+  struct StepRecord { uint64_t timestamp; char label; int32_t position; };
+  static constexpr std::size_t step_records_size = 0x10000;
+  static StepRecord step_records[step_records_size];
+  static std::atomic<std::size_t> step_records_head, step_records_tail;
+
 };
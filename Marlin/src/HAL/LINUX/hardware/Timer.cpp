@@ -33,6 +33,7 @@ Timer::Timer() {
   cbfn = nullptr;
   period = 0;
   start_time = 0;
+  expiry = 0;
   avg_error = 0;
 }
 
@@ -88,26 +89,28 @@ void Timer::disable() {
 }
 
 void Timer::setCompare(uint32_t compare) {
-  uint32_t nsec_offset = 0;
-  if (active) {
-    nsec_offset = Clock::nanos() - this->start_time; // calculate how long the timer would have been running for
-    nsec_offset = nsec_offset < 1000 ? nsec_offset : 0; // constrain, this shouldn't be needed but apparently Marlin enables interrupts on the stepper timer before initialising it, todo: investigate ?bug?
-  }
+  const uint64_t now = Clock::nanos();
+  if (!active || !start_time) start_time = now;
+
+  // Like a hardware timer, count from the last compare match (not from now)
+  // so the time spent in the ISR doesn't stretch the period.
   this->compare = compare;
-  uint64_t ns = Clock::ticksToNanos(compare, frequency) - nsec_offset;
+  const uint64_t interval = Clock::ticksToNanos(compare, frequency);
+  expiry = start_time + interval;
+  const uint64_t ns = expiry > now + 1000 ? expiry - now : 1000;
+
   struct itimerspec its;
   its.it_value.tv_sec = ns / 1000000000;
   its.it_value.tv_nsec = ns % 1000000000;
-  its.it_interval.tv_sec = its.it_value.tv_sec;
-  its.it_interval.tv_nsec = its.it_value.tv_nsec;
+  its.it_interval.tv_sec = interval / 1000000000;
+  its.it_interval.tv_nsec = interval % 1000000000;
 
   if (timer_settime(timerid, 0, &its, nullptr) == -1) {
     printf("timer(%ld) failed, compare: %d(%ld)\n", getID(), compare, its.it_value.tv_nsec);
     return; // todo: handle error
   }
   //printf("timer(%ld) started, compare: %d(%d)\n", getID(), compare, its.it_value.tv_nsec);
-  this->period = its.it_value.tv_nsec;
-  this->start_time = Clock::nanos();
+  this->period = interval;
 }
 
 uint32_t Timer::getCount() {
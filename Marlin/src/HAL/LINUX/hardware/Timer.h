@@ -54,9 +54,12 @@ public:
 
   static void handler(int sig, siginfo_t *si, void *uc) {
     Timer* _this = (Timer*)si->si_value.sival_ptr;
-    _this->avg_error += (Clock::nanos() - _this->start_time) - _this->period; //high_resolution_clock is also limited in precision, but best we have
+    const uint64_t now = Clock::nanos();
+    _this->avg_error += (now - _this->start_time) - _this->period; //high_resolution_clock is also limited in precision, but best we have
     _this->avg_error /= 2; //very crude precision analysis (actually within +-500ns usually)
-    _this->start_time = Clock::nanos(); // wrap
+    // The counter restarts at the scheduled match. (The signal may come a little early.)
+    _this->start_time = _this->expiry < now ? _this->expiry : now;
+    _this->expiry = _this->start_time + _this->period; // Auto-reload if the ISR doesn't set a new compare
     _this->cbfn();
     _this->overruns += timer_getoverrun(_this->timerid); // even at 50Khz this doesn't stay zero, again demonstrating the limitations
                                                          // using a realtime linux kernel would help somewhat
@@ -73,4 +76,5 @@ private:
   uint64_t period;
   uint64_t avg_error;
   uint64_t start_time;
+  uint64_t expiry;
 };
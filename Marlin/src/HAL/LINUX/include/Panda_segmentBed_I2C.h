@@ -0,0 +1,51 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * Simulated Bed Distance Sensor, standing in for the Panda_SoftMasterI2C
+ * library. The distance is from the stepper position of the sensor to a
+ * tilted, wavy bed, in the sensor's 0.01mm units.
+ */
+
+#include "../../../module/planner.h"
+#include "../../../module/probe.h"
+
+class I2C_SegmentBED {
+public:
+  // Height of the simulated bed at a point
+  static float bed_z(const xy_pos_t &p) {
+    return 0.1f + 0.002f * (p.x - 100) - 0.001f * (p.y - 100) + 0.15f * sin(p.x / 25) * cos(p.y / 35);
+  }
+
+  int i2c_init(unsigned char, unsigned char, unsigned char, int) { return 1; }
+
+  unsigned short BD_i2c_read() {
+    const xy_pos_t sensor = xy_pos_t({ planner.get_axis_position_mm(X_AXIS), planner.get_axis_position_mm(Y_AXIS) }) + probe.offset_xy;
+    const float d = planner.get_axis_position_mm(Z_AXIS) - bed_z(sensor);
+    return (unsigned short)LROUND(constrain(d, 0, 10.19f) * 100);
+  }
+
+  bool BD_Check_OddEven(unsigned short) { return true; }
+  void BD_i2c_write(unsigned int) {}
+  void BD_i2c_stop() {}
+};
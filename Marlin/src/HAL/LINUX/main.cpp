@@ -23,6 +23,7 @@
 #ifdef __PLAT_LINUX__
 
 //#define GPIO_LOGGING // Full GPIO and Positional Logging
+//#define STEP_LOGGING // Log every axis step with its timestamp, e.g., to check Input Shaping
 
 #include "../../inc/MarlinConfig.h"
 #include "../shared/Delay.h"
@@ -68,6 +69,11 @@ void simulation_loop() {
   LinearAxis z_axis(Z_ENABLE_PIN, Z_DIR_PIN, Z_STEP_PIN, Z_MIN_PIN, Z_MAX_PIN);
   LinearAxis extruder0(E0_ENABLE_PIN, E0_DIR_PIN, E0_STEP_PIN, P_NC, P_NC);
 
+  #ifdef STEP_LOGGING
+    x_axis.label = 'X'; y_axis.label = 'Y'; z_axis.label = 'Z'; extruder0.label = 'E';
+    LinearAxis::step_log = fopen("axis_step_log.csv", "w");
+  #endif
+
   #ifdef GPIO_LOGGING
     IOLoggerCSV logger("all_gpio_log.csv");
     Gpio::attachLogger(&logger);
@@ -101,6 +107,10 @@ void simulation_loop() {
       logger.flush();
     #endif
 
+    #ifdef STEP_LOGGING
+      LinearAxis::flush_step_log();
+    #endif
+
     std::this_thread::yield();
   }
 }
@@ -0,0 +1,67 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2022 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#ifdef __PLAT_LINUX__
+
+#include "../../inc/MarlinConfig.h"
+
+#if BOTH(SDSUPPORT, SDIO_SUPPORT)
+
+/**
+ * SD card emulated with a FAT image file in the working directory,
+ * e.g., made with 'mkfs.vfat -C sdcard.img 65536' and filled with 'mcopy'.
+ * Add '#define SDIO_SUPPORT' to the configuration to use it.
+ */
+
+#include <stdio.h>
+
+static const char sd_filename[] = "sdcard.img";
+static FILE *sd_file = nullptr;
+static uint32_t sd_blocks; // = 0
+
+bool SDIO_Init() {
+  if (!sd_file) sd_file = fopen(sd_filename, "r+b");
+  if (!sd_file) return false;
+  fseek(sd_file, 0L, SEEK_END);
+  sd_blocks = ftell(sd_file) / 512;
+  return sd_blocks > 0;
+}
+
+bool SDIO_ReadBlock(uint32_t block, uint8_t *dst) {
+  if (!sd_file || block >= sd_blocks) return false;
+  fseek(sd_file, long(block) * 512, SEEK_SET);
+  return fread(dst, 1, 512, sd_file) == 512;
+}
+
+bool SDIO_WriteBlock(uint32_t block, const uint8_t *src) {
+  if (!sd_file || block >= sd_blocks) return false;
+  fseek(sd_file, long(block) * 512, SEEK_SET);
+  const bool ok = fwrite(src, 1, 512, sd_file) == 512;
+  fflush(sd_file);
+  return ok;
+}
+
+bool SDIO_IsReady() { return sd_file != nullptr; }
+
+uint32_t SDIO_GetCardSize() { return sd_blocks * 512; }
+
+#endif // SDSUPPORT && SDIO_SUPPORT
+#endif // __PLAT_LINUX__
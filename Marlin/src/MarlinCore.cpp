@@ -89,6 +89,14 @@
   #include "feature/direct_stepping.h"
 #endif
 
+#if ENABLED(FT_MOTION)
+  #include "module/ft_motion.h"
+#endif
+
+#if ENABLED(SEGMENT_COALESCING)
+  #include "feature/coalescer.h"
+#endif
+
 #if ENABLED(HOST_ACTION_COMMANDS)
   #include "feature/host_actions.h"
 #endif
@@ -789,6 +797,16 @@ void idle(bool no_stepper_sleep/*=false*/) {
   // Core Marlin activities
   manage_inactivity(no_stepper_sleep);
 
+  // Generate Fixed-Time Motion steps from planner blocks
+  TERN_(FT_MOTION, ftMotion.loop());
+
+  // Compute step events ahead of the Stepper ISR
+  TERN_(STEP_EVENT_QUEUE, stepper.fill_step_events());
+
+  // Release moves held back for coalescing or blending if the planner is running dry
+  TERN_(SEGMENT_COALESCING, coalescer.task());
+  TERN_(PATH_BLENDING, planner.blend_task());
+
   // Manage Heaters (and Watchdog)
   thermalManager.task();
 
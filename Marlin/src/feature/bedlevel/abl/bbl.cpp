@@ -35,6 +35,10 @@
   #include "../../../lcd/extui/ui_api.h"
 #endif
 
+#if BOTH(ABL_BILINEAR_BICUBIC, MARLIN_TEST_BUILD)
+  #include "../../../tests/test_helpers.h"
+#endif
+
 LevelingBilinear bedlevel;
 
 xy_pos_t LevelingBilinear::grid_spacing,
@@ -166,6 +170,8 @@ void LevelingBilinear::print_leveling_grid(const bed_mesh_t* _z_values /*= NULL*
   #endif
 }
 
+#define LINEAR_EXTRAPOLATION(E, I) ((E) * 2 - (I))
+
 #if ENABLED(ABL_BILINEAR_SUBDIVISION)
 
   #define ABL_TEMP_POINTS_X (GRID_MAX_POINTS_X + 2)
@@ -174,7 +180,6 @@ void LevelingBilinear::print_leveling_grid(const bed_mesh_t* _z_values /*= NULL*
   xy_pos_t LevelingBilinear::grid_spacing_virt;
   xy_float_t LevelingBilinear::grid_factor_virt;
 
-  #define LINEAR_EXTRAPOLATION(E, I) ((E) * 2 - (I))
   float LevelingBilinear::bed_level_virt_coord(const uint8_t x, const uint8_t y) {
     uint8_t ep = 0, ip = 1;
     if (x > (GRID_MAX_POINTS_X) + 1 || y > (GRID_MAX_POINTS_Y) + 1) {
@@ -261,6 +266,52 @@ void LevelingBilinear::print_leveling_grid(const bed_mesh_t* _z_values /*= NULL*
 
 #endif // ABL_BILINEAR_SUBDIVISION
 
+#if ENABLED(ABL_BILINEAR_BICUBIC)
+
+  float LevelingBilinear::bicubic_coeff[4][4];
+
+  /**
+   * Z at a grid point, linearly extrapolating one point beyond each edge
+   * as the subdivided grid does
+   */
+  float LevelingBilinear::bicubic_point(const int8_t x, const int8_t y) {
+    if (x < 0) return LINEAR_EXTRAPOLATION(bicubic_point(0, y), bicubic_point(1, y));
+    if (x > (GRID_MAX_POINTS_X) - 1) return LINEAR_EXTRAPOLATION(bicubic_point((GRID_MAX_POINTS_X) - 1, y), bicubic_point((GRID_MAX_POINTS_X) - 2, y));
+    if (y < 0) return LINEAR_EXTRAPOLATION(bicubic_point(x, 0), bicubic_point(x, 1));
+    if (y > (GRID_MAX_POINTS_Y) - 1) return LINEAR_EXTRAPOLATION(bicubic_point(x, (GRID_MAX_POINTS_Y) - 1), bicubic_point(x, (GRID_MAX_POINTS_Y) - 2));
+    return z_values[x][y];
+  }
+
+  /**
+   * Get the polynomial coefficients of the Catmull-Rom patch over the cell
+   * at 'g' from the 4x4 grid points around it, so that
+   *   Z = sum(bicubic_coeff[i][j] * tx^i * ty^j)
+   * Only one cell is kept, so this runs again when a move enters a new cell.
+   */
+  void LevelingBilinear::bicubic_cell(const xy_int8_t &g) {
+    // Catmull-Rom basis. Coefficients of t^0..t^3 for the 4 control points, times 2.
+    static constexpr int8_t cmr[4][4] = { { 0, 2, 0, 0 }, { -1, 0, 1, 0 }, { 2, -5, 4, -1 }, { -1, 3, -3, 1 } };
+
+    float p[4][4], m[4][4];
+    LOOP_L_N(i, 4) LOOP_L_N(j, 4) p[i][j] = bicubic_point(g.x + i - 1, g.y + j - 1);
+
+    // Rows in X to polynomials in ty
+    LOOP_L_N(i, 4) LOOP_L_N(n, 4) {
+      float c = 0;
+      LOOP_L_N(j, 4) c += cmr[n][j] * p[i][j];
+      m[i][n] = c;
+    }
+
+    // Polynomials in ty to polynomials in tx and ty
+    LOOP_L_N(k, 4) LOOP_L_N(n, 4) {
+      float c = 0;
+      LOOP_L_N(i, 4) c += cmr[k][i] * m[i][n];
+      bicubic_coeff[k][n] = c * 0.25f;
+    }
+  }
+
+#endif // ABL_BILINEAR_BICUBIC
+
 // Refresh after other values have been updated
 void LevelingBilinear::refresh_bed_level() {
   TERN_(ABL_BILINEAR_SUBDIVISION, bed_level_virt_interpolate());
@@ -285,17 +336,27 @@ void LevelingBilinear::refresh_bed_level() {
 // Get the Z adjustment for non-linear bed leveling
 float LevelingBilinear::get_z_correction(const xy_pos_t &raw) {
 
-  static float z1, d2, z3, d4, L, D;
+  #if ENABLED(ABL_BILINEAR_BICUBIC)
+    static float cx[4];   // Patch polynomial in tx at the current ty
+  #else
+    static float z1, d2, z3, d4, L, D;
+  #endif
 
   static xy_pos_t ratio;
+  #if BOTH(ABL_BILINEAR_BICUBIC, EXTRAPOLATE_BEYOND_GRID)
+    static xy_pos_t beyond; // Distance past the patch edge, in cells
+  #endif
 
   // Whole units for the grid line indices. Constrained within bounds.
-  static xy_int8_t thisg, nextg;
+  static xy_int8_t thisg;
+  #if DISABLED(ABL_BILINEAR_BICUBIC)
+    static xy_int8_t nextg;
+  #endif
 
   // XY relative to the probed area
   xy_pos_t rel = raw - grid_start.asFloat();
 
-  #if ENABLED(EXTRAPOLATE_BEYOND_GRID)
+  #if EITHER(EXTRAPOLATE_BEYOND_GRID, ABL_BILINEAR_BICUBIC)
     #define FAR_EDGE_OR_BOX 2   // Keep using the last grid box
   #else
     #define FAR_EDGE_OR_BOX 1   // Just use the grid far edge
@@ -307,13 +368,18 @@ float LevelingBilinear::get_z_correction(const xy_pos_t &raw) {
     const float gx = constrain(FLOOR(ratio.x), 0, ABL_BG_POINTS_X - (FAR_EDGE_OR_BOX));
     ratio.x -= gx;      // Subtract whole to get the ratio within the grid box
 
-    #if DISABLED(EXTRAPOLATE_BEYOND_GRID)
+    #if ENABLED(ABL_BILINEAR_BICUBIC)
+      // The patch only holds within the box. Beyond the grid keep the edge height or slope.
+      const float tx = constrain(ratio.x, 0, 1);
+      TERN_(EXTRAPOLATE_BEYOND_GRID, beyond.x = ratio.x - tx);
+      ratio.x = tx;
+    #elif DISABLED(EXTRAPOLATE_BEYOND_GRID)
       // Beyond the grid maintain height at grid edges
       NOLESS(ratio.x, 0); // Never <0 (>1 is ok when nextg.x==thisg.x)
     #endif
 
     thisg.x = gx;
-    nextg.x = _MIN(thisg.x + 1, ABL_BG_POINTS_X - 1);
+    IF_DISABLED(ABL_BILINEAR_BICUBIC, nextg.x = _MIN(thisg.x + 1, ABL_BG_POINTS_X - 1));
   }
 
   if (cached_rel.y != rel.y || cached_g.x != thisg.x) {
@@ -324,32 +390,62 @@ float LevelingBilinear::get_z_correction(const xy_pos_t &raw) {
       const float gy = constrain(FLOOR(ratio.y), 0, ABL_BG_POINTS_Y - (FAR_EDGE_OR_BOX));
       ratio.y -= gy;
 
-      #if DISABLED(EXTRAPOLATE_BEYOND_GRID)
+      #if ENABLED(ABL_BILINEAR_BICUBIC)
+        const float ty = constrain(ratio.y, 0, 1);
+        TERN_(EXTRAPOLATE_BEYOND_GRID, beyond.y = ratio.y - ty);
+        ratio.y = ty;
+      #elif DISABLED(EXTRAPOLATE_BEYOND_GRID)
         // Beyond the grid maintain height at grid edges
         NOLESS(ratio.y, 0); // Never < 0.0. (> 1.0 is ok when nextg.y==thisg.y.)
       #endif
 
       thisg.y = gy;
-      nextg.y = _MIN(thisg.y + 1, ABL_BG_POINTS_Y - 1);
+      IF_DISABLED(ABL_BILINEAR_BICUBIC, nextg.y = _MIN(thisg.y + 1, ABL_BG_POINTS_Y - 1));
     }
 
     if (cached_g != thisg) {
       cached_g = thisg;
-      // Z at the box corners
-      z1 = ABL_BG_GRID(thisg.x, thisg.y);       // left-front
-      d2 = ABL_BG_GRID(thisg.x, nextg.y) - z1;  // left-back (delta)
-      z3 = ABL_BG_GRID(nextg.x, thisg.y);       // right-front
-      d4 = ABL_BG_GRID(nextg.x, nextg.y) - z3;  // right-back (delta)
+      #if ENABLED(ABL_BILINEAR_BICUBIC)
+        bicubic_cell(thisg);
+      #else
+        // Z at the box corners
+        z1 = ABL_BG_GRID(thisg.x, thisg.y);       // left-front
+        d2 = ABL_BG_GRID(thisg.x, nextg.y) - z1;  // left-back (delta)
+        z3 = ABL_BG_GRID(nextg.x, thisg.y);       // right-front
+        d4 = ABL_BG_GRID(nextg.x, nextg.y) - z3;  // right-back (delta)
+      #endif
     }
 
-    // Bilinear interpolate. Needed since rel.y or thisg.x has changed.
-                L = z1 + d2 * ratio.y;   // Linear interp. LF -> LB
-    const float R = z3 + d4 * ratio.y;   // Linear interp. RF -> RB
+    #if ENABLED(ABL_BILINEAR_BICUBIC)
+      // Evaluate the patch at ty. Needed since rel.y or thisg.x has changed.
+      LOOP_L_N(i, 4)
+        cx[i] = ((bicubic_coeff[i][3] * ratio.y + bicubic_coeff[i][2]) * ratio.y + bicubic_coeff[i][1]) * ratio.y + bicubic_coeff[i][0];
 
-    D = R - L;
+      #if ENABLED(EXTRAPOLATE_BEYOND_GRID)
+        // Past the front or back edge continue along the slope in Y
+        if (beyond.y) LOOP_L_N(i, 4)
+          cx[i] += beyond.y * ((3 * bicubic_coeff[i][3] * ratio.y + 2 * bicubic_coeff[i][2]) * ratio.y + bicubic_coeff[i][1]);
+      #endif
+    #else
+      // Bilinear interpolate. Needed since rel.y or thisg.x has changed.
+                  L = z1 + d2 * ratio.y;   // Linear interp. LF -> LB
+      const float R = z3 + d4 * ratio.y;   // Linear interp. RF -> RB
+
+      D = R - L;
+    #endif
   }
 
-  const float offset = L + ratio.x * D;   // the offset almost always changes
+  // The offset almost always changes
+  #if ENABLED(ABL_BILINEAR_BICUBIC)
+    float offset = ((cx[3] * ratio.x + cx[2]) * ratio.x + cx[1]) * ratio.x + cx[0];
+
+    #if ENABLED(EXTRAPOLATE_BEYOND_GRID)
+      // Past the left or right edge continue along the slope in X
+      if (beyond.x) offset += beyond.x * ((3 * cx[3] * ratio.x + 2 * cx[2]) * ratio.x + cx[1]);
+    #endif
+  #else
+    const float offset = L + ratio.x * D;
+  #endif
 
   /*
   static float last_offset = 0;
@@ -366,6 +462,129 @@ float LevelingBilinear::get_z_correction(const xy_pos_t &raw) {
   return offset;
 }
 
+#if BOTH(ABL_BILINEAR_BICUBIC, MARLIN_TEST_BUILD)
+
+  #ifdef BILINEAR_SUBDIVISIONS
+    #define TEST_SUBDIVISIONS BILINEAR_SUBDIVISIONS
+  #else
+    #define TEST_SUBDIVISIONS 3
+  #endif
+  #define TEST_VIRT_X (GRID_MAX_CELLS_X * (TEST_SUBDIVISIONS) + 1)
+  #define TEST_VIRT_Y (GRID_MAX_CELLS_Y * (TEST_SUBDIVISIONS) + 1)
+
+  static float test_virt[TEST_VIRT_X][TEST_VIRT_Y];
+
+  // A smooth bed with a tilt, a twist and a bow
+  static float test_bed(const xy_pos_t &p) {
+    return 0.0005f * p.x - 0.0003f * p.y + 0.15f * sin(p.x * 0.025f) * cos(p.y * 0.02f);
+  }
+
+  // Bilinear interpolation as without ABL_BILINEAR_BICUBIC, on a grid of 'nx' by 'ny' points
+  template<typename T>
+  static float test_bilinear(const T *z, const uint8_t nx, const uint8_t ny, const xy_pos_t &p) {
+    const xy_pos_t cells = { float(nx - 1) / (GRID_MAX_CELLS_X), float(ny - 1) / (GRID_MAX_CELLS_Y) },
+                   r = (p - bedlevel.grid_start) * cells / bedlevel.grid_spacing;
+    const uint8_t gx = constrain(FLOOR(r.x), 0, nx - 2), gy = constrain(FLOOR(r.y), 0, ny - 2);
+    const float tx = r.x - gx, ty = r.y - gy,
+                l = z[gx * ny + gy] + (z[gx * ny + gy + 1] - z[gx * ny + gy]) * ty,
+                h = z[(gx + 1) * ny + gy] + (z[(gx + 1) * ny + gy + 1] - z[(gx + 1) * ny + gy]) * ty;
+    return l + (h - l) * tx;
+  }
+
+  static float test_raw(const xy_pos_t &p) { return test_bilinear(bedlevel.z_values[0], GRID_MAX_POINTS_X, GRID_MAX_POINTS_Y, p); }
+  static float test_subdivided(const xy_pos_t &p) { return test_bilinear(test_virt[0], TEST_VIRT_X, TEST_VIRT_Y, p); }
+  static float test_bicubic(const xy_pos_t &p) { return bedlevel.get_z_correction(p); }
+
+  /**
+   * Probe a smooth test bed at the grid points and report, for bilinear on
+   * the probed grid, bilinear on a Catmull-Rom subdivided grid (as with
+   * ABL_BILINEAR_SUBDIVISION) and the bicubic patches, the evaluations per
+   * second along 1mm steps in X and the largest error from the test bed.
+   * The bicubic surface is the one the subdivided grid samples, so its error
+   * must be no larger.
+   *
+   * Then probe a grid inset from the bed edges and check the surface past
+   * the grid. It must go on linearly with EXTRAPOLATE_BEYOND_GRID, and keep
+   * the edge height without it. The stored mesh is restored afterward.
+   */
+  void test_bilinear_bicubic() {
+    bed_mesh_t saved_z;
+    COPY(saved_z, bedlevel.z_values);
+    const xy_pos_t saved_spacing = bedlevel.grid_spacing, saved_start = bedlevel.grid_start;
+
+    auto probe_test_bed = [](const xy_pos_t &spacing, const xy_pos_t &start) {
+      bedlevel.set_grid(spacing, start);
+      GRID_LOOP(x, y) bedlevel.z_values[x][y] = test_bed({ bedlevel.get_mesh_x(x), bedlevel.get_mesh_y(y) });
+      bedlevel.refresh_bed_level();
+    };
+
+    probe_test_bed({ float(X_BED_SIZE) / (GRID_MAX_CELLS_X), float(Y_BED_SIZE) / (GRID_MAX_CELLS_Y) }, { X_MIN_BED, Y_MIN_BED });
+
+    // The subdivided grid holds the bicubic surface at the subdivision points
+    LOOP_L_N(x, TEST_VIRT_X) LOOP_L_N(y, TEST_VIRT_Y)
+      test_virt[x][y] = test_bicubic(bedlevel.grid_start + bedlevel.grid_spacing * xy_pos_t({ float(x), float(y) }) / float(TEST_SUBDIVISIONS));
+
+    // Points 1mm apart along rows 1mm apart
+    const uint16_t row_points = X_BED_SIZE + 1, rows = Y_BED_SIZE + 1;
+    auto test_point = [row_points, rows](const uint32_t i) -> xy_pos_t {
+      return { X_MIN_BED + float(i % row_points), Y_MIN_BED + float((i / row_points) % rows) };
+    };
+
+    auto rate = [&test_point](float (*eval)(const xy_pos_t&)) {
+      return test_calls_per_second([&](const uint32_t i) { test_keep(eval(test_point(i))); });
+    };
+
+    // Largest error from the test bed, in microns
+    auto error = [&test_point, row_points, rows](float (*eval)(const xy_pos_t&)) -> float {
+      float worst = 0;
+      for (uint32_t i = 0; i < uint32_t(row_points) * rows; ++i) {
+        const xy_pos_t p = test_point(i);
+        NOLESS(worst, ABS(eval(p) - test_bed(p)));
+      }
+      return worst * 1000;
+    };
+
+    SERIAL_ECHOLNPGM("ABL Z per second, bilinear: ", rate(test_raw),
+                     " subdivided x", TEST_SUBDIVISIONS, ": ", rate(test_subdivided),
+                     " bicubic: ", rate(test_bicubic));
+    const float subdivided_error = error(test_subdivided);
+    SERIAL_ECHOPGM("ABL max error, bilinear: ");
+    SERIAL_ECHO_F(error(test_raw), 3);
+    SERIAL_ECHOPGM("um subdivided: ");
+    SERIAL_ECHO_F(subdivided_error, 3);
+    SERIAL_ECHOLNPGM("um");
+    test_max_error(F("ABL bicubic max error"), error(test_bicubic), subdivided_error, F("um"));
+
+    // Walk out from each edge of a grid inset by 'margin', in two equal steps
+    constexpr float margin = 20;
+    probe_test_bed({ (X_BED_SIZE - 2 * margin) / (GRID_MAX_CELLS_X), (Y_BED_SIZE - 2 * margin) / (GRID_MAX_CELLS_Y) }, { X_MIN_BED + margin, Y_MIN_BED + margin });
+    const xy_pos_t grid_end = bedlevel.grid_start + bedlevel.grid_spacing * xy_pos_t({ float(GRID_MAX_CELLS_X), float(GRID_MAX_CELLS_Y) });
+    float worst = 0;
+    auto check_ray = [&worst](const xy_pos_t &edge, const xy_pos_t &step) {
+      const float z0 = test_bicubic(edge), z1 = test_bicubic(edge + step), z2 = test_bicubic(edge + step * 2);
+      #if ENABLED(EXTRAPOLATE_BEYOND_GRID)
+        NOLESS(worst, ABS(z2 - 2 * z1 + z0));            // Linear
+      #else
+        NOLESS(worst, _MAX(ABS(z1 - z0), ABS(z2 - z0))); // Flat
+      #endif
+    };
+    for (float x = bedlevel.grid_start.x; x <= grid_end.x; ++x) {
+      check_ray({ x, bedlevel.grid_start.y }, { 0, -margin / 2 });
+      check_ray({ x, grid_end.y }, { 0, margin / 2 });
+    }
+    for (float y = bedlevel.grid_start.y; y <= grid_end.y; ++y) {
+      check_ray({ bedlevel.grid_start.x, y }, { -margin / 2, 0 });
+      check_ray({ grid_end.x, y }, { margin / 2, 0 });
+    }
+    test_max_error(F(TERN(EXTRAPOLATE_BEYOND_GRID, "ABL bicubic beyond grid, max departure from linear", "ABL bicubic beyond grid, max departure from edge")), worst * 1000, 0.1f, F("um"));
+
+    COPY(bedlevel.z_values, saved_z);
+    bedlevel.set_grid(saved_spacing, saved_start);
+    bedlevel.refresh_bed_level();
+  }
+
+#endif
+
 #if IS_CARTESIAN && DISABLED(SEGMENT_LEVELED_MOVES)
 
   #define CELL_INDEX(A,V) ((V - grid_start.A) * ABL_BG_FACTOR(A))
@@ -49,6 +49,12 @@ private:
     static void bed_level_virt_interpolate();
   #endif
 
+  #if ENABLED(ABL_BILINEAR_BICUBIC)
+    static float bicubic_coeff[4][4];
+    static float bicubic_point(const int8_t x, const int8_t y);
+    static void bicubic_cell(const xy_int8_t &g);
+  #endif
+
 public:
   static void reset();
   static void set_grid(const xy_pos_t& _grid_spacing, const xy_pos_t& _grid_start);
@@ -68,3 +74,7 @@ public:
 };
 
 extern LevelingBilinear bedlevel;
+
+#if BOTH(ABL_BILINEAR_BICUBIC, MARLIN_TEST_BUILD)
+  void test_bilinear_bicubic();
+#endif
@@ -35,7 +35,12 @@
 #include "../../../module/endstops.h"
 #include "../../babystep.h"
 
+#if ENABLED(BD_SENSOR_FLYING_SCAN)
+  #include "../../../lcd/marlinui.h"
+#endif
+
 // I2C software Master library for segment bed heating and bed distance sensor
+// (The Linux HAL provides a simulated sensor in its place.)
 #include <Panda_segmentBed_I2C.h>
 
 #include "bdl.h"
@@ -78,6 +83,91 @@ float BDS_Leveling::read() {
   return BD_z;
 }
 
+#if ENABLED(BD_SENSOR_FLYING_SCAN)
+
+  /**
+   * Scan the bed in serpentine rows at constant speed, reading the sensor every
+   * BD_SENSOR_SCAN_INTERVAL ms while the nozzle moves. Each sample is placed
+   * at the stepper position, averaged over the time of the read.
+   *
+   * A grid point takes the samples within one grid spacing of it along its row,
+   * weighted by distance, and fits a line through them to get its height. This
+   * stays accurate at the ends of rows, where all samples are on one side.
+   */
+  bool BDS_Leveling::scan_grid(const xy_pos_t &start, const xy_float_t &spacing, bed_mesh_t &z_values, const uint8_t verbose_level) {
+    // Weighted sums for a line z = a + b * dx through the samples near each point
+    struct { float w, wd, wdd, wz, wzd; } fit[GRID_MAX_POINTS_X][GRID_MAX_POINTS_Y];
+    ZERO(fit);
+
+    uint16_t samples = 0;
+    const millis_t scan_start_ms = millis();
+    const feedRate_t old_feedrate = feedrate_mm_s;
+    bool zig = true;
+
+    for (uint8_t j = 0; j < GRID_MAX_POINTS_Y; ++j, zig ^= true) {
+      TERN_(HAS_STATUS_MESSAGE, ui.status_printf(0, F("Scanning row %i/%i"), int(j + 1), int(GRID_MAX_POINTS_Y)));
+
+      // Travel to the start of the row. The grid is in probe coordinates.
+      const float row_y = start.y + j * spacing.y;
+      const xy_pos_t row_l = { start.x, row_y }, row_r = { start.x + (GRID_MAX_POINTS_X - 1) * spacing.x, row_y };
+      do_blocking_move_to_xy((zig ? row_l : row_r) - probe.offset_xy, feedRate_t(XY_PROBE_FEEDRATE_MM_S));
+
+      // Scan the row at constant speed, sampling while the move runs
+      destination = current_position;
+      destination.set((zig ? row_r : row_l) - probe.offset_xy);
+      feedrate_mm_s = MMM_TO_MMS(BD_SENSOR_SCAN_FEEDRATE);
+      prepare_line_to_destination();
+
+      millis_t next_sample_ms = millis();
+      while (planner.busy()) {
+        idle_no_sleep();
+        const millis_t ms = millis();
+        if (PENDING(ms, next_sample_ms)) continue;
+        next_sample_ms = ms + (BD_SENSOR_SCAN_INTERVAL);
+
+        get_cartesian_from_steppers();
+        const xyz_pos_t before = cartes;
+        const float d = read();
+        get_cartesian_from_steppers();
+        if (isnan(d)) continue;
+
+        const xy_pos_t pos = (xy_pos_t(before) + xy_pos_t(cartes)) * 0.5f + probe.offset_xy;
+        const float z = cartes.z - d,
+                    gx = (pos.x - start.x) / spacing.x;
+
+        // Add the sample to the two nearest grid points on the row
+        const int8_t i0 = FLOOR(gx);
+        for (int8_t i = _MAX(i0, 0); i <= _MIN(i0 + 1, GRID_MAX_POINTS_X - 1); ++i) {
+          const float dx = (gx - i) * spacing.x, w = 1 - ABS(dx) / spacing.x;
+          auto &f = fit[i][j];
+          f.w += w; f.wd += w * dx; f.wdd += w * sq(dx); f.wz += w * z; f.wzd += w * z * dx;
+        }
+        samples++;
+      }
+    }
+
+    feedrate_mm_s = old_feedrate;
+
+    // Fit each grid point. Use the mean if the samples are too close together for a line.
+    for (uint8_t j = 0; j < GRID_MAX_POINTS_Y; ++j)
+      for (uint8_t i = 0; i < GRID_MAX_POINTS_X; ++i) {
+        const auto &f = fit[i][j];
+        if (f.w <= 0) {
+          SERIAL_ECHOLNPGM("BD sensor scan: no samples near point ", i, ",", j);
+          return false;
+        }
+        const float det = f.w * f.wdd - sq(f.wd);
+        z_values[i][j] = det > sq(0.05f * spacing.x * f.w) ? (f.wdd * f.wz - f.wd * f.wzd) / det : f.wz / f.w;
+      }
+
+    if (verbose_level)
+      SERIAL_ECHOLNPGM("BD sensor scan: ", samples, " samples in ", millis() - scan_start_ms, "ms");
+
+    return true;
+  }
+
+#endif // BD_SENSOR_FLYING_SCAN
+
 void BDS_Leveling::process() {
  //if (config_state == 0) return;
  static millis_t next_check_ms = 0; // starting at T=0
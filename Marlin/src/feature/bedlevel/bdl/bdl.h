@@ -21,7 +21,11 @@
  */
 #pragma once
 
-#include <stdint.h>
+#include "../../../inc/MarlinConfigPre.h"
+
+#if ENABLED(BD_SENSOR_FLYING_SCAN)
+  #include "../bedlevel.h"
+#endif
 
 class BDS_Leveling {
 public:
@@ -31,6 +35,9 @@ public:
   static void init(uint8_t _sda, uint8_t _scl, uint16_t delay_s);
   static void process();
   static float read();
+  #if ENABLED(BD_SENSOR_FLYING_SCAN)
+    static bool scan_grid(const xy_pos_t &start, const xy_float_t &spacing, bed_mesh_t &z_values, const uint8_t verbose_level);
+  #endif
 };
 
 extern BDS_Leveling bdl;
@@ -27,7 +27,7 @@
 #include "bedlevel.h"
 #include "../../module/planner.h"
 
-#if EITHER(MESH_BED_LEVELING, PROBE_MANUALLY)
+#if ANY(MESH_BED_LEVELING, PROBE_MANUALLY, ADAPTIVE_MESH)
   #include "../../module/motion.h"
 #endif
 
@@ -134,7 +134,8 @@ void reset_bed_level() {
   /**
    * Print calibration results for plotting or manual frame adjustment.
    */
-  void print_2d_array(const uint8_t sx, const uint8_t sy, const uint8_t precision, const float *values) {
+  template<typename T>
+  void print_2d_array(const uint8_t sx, const uint8_t sy, const uint8_t precision, const T *values) {
     #ifndef SCAD_MESH_OUTPUT
       LOOP_L_N(x, sx) {
         serial_spaces(precision + (x < 10 ? 3 : 2));
@@ -185,8 +186,51 @@ void reset_bed_level() {
     SERIAL_EOL();
   }
 
+  template void print_2d_array(const uint8_t, const uint8_t, const uint8_t, const float*);
+  #if ENABLED(COMPACT_MESH_Z)
+    template void print_2d_array(const uint8_t, const uint8_t, const uint8_t, const mesh_z_t*);
+  #endif
+
 #endif // AUTO_BED_LEVELING_BILINEAR || MESH_BED_LEVELING
 
+#if ENABLED(ADAPTIVE_MESH)
+
+  PrintArea print_area;
+
+  bool PrintArea::valid, PrintArea::limit;
+  xy_pos_t PrintArea::min, PrintArea::max;
+  xy_uint8_t PrintArea::grid_min, PrintArea::grid_max;
+
+  /**
+   * Select the mesh points around the print area plus ADAPTIVE_MESH_MARGIN,
+   * including the corners of every cell the area touches.
+   */
+  void PrintArea::select_grid(const xy_pos_t &start, const xy_float_t &spacing) {
+    xy_pos_t lo = min, hi = max;
+    toNative(lo);
+    toNative(hi);
+    const xy_float_t margin = { ADAPTIVE_MESH_MARGIN, ADAPTIVE_MESH_MARGIN };
+    const xy_float_t glo = (lo - margin - start) / spacing,
+                     ghi = (hi + margin - start) / spacing;
+    grid_min.set(constrain(FLOOR(glo.x), 0, (GRID_MAX_POINTS_X) - 1), constrain(FLOOR(glo.y), 0, (GRID_MAX_POINTS_Y) - 1));
+    grid_max.set(constrain(CEIL(ghi.x), grid_min.x, (GRID_MAX_POINTS_X) - 1), constrain(CEIL(ghi.y), grid_min.y, (GRID_MAX_POINTS_Y) - 1));
+    limit = true;
+  }
+
+  /**
+   * Give unprobed points outside the selected area the height of the nearest
+   * point on its edge, for a mesh that had no data there before.
+   */
+  void PrintArea::fill_outside(bed_mesh_t &z) {
+    if (!limit) return;
+    GRID_LOOP(x, y) if (isnan(z[x][y])) {
+      z[x][y] = z[constrain(x, grid_min.x, grid_max.x)][constrain(y, grid_min.y, grid_max.y)];
+      TERN_(EXTENSIBLE_UI, if (!isnan(z[x][y])) ExtUI::onMeshUpdate(x, y, z[x][y]));
+    }
+  }
+
+#endif // ADAPTIVE_MESH
+
 #if EITHER(MESH_BED_LEVELING, PROBE_MANUALLY)
 
   void _manual_goto_xy(const xy_pos_t &pos) {
@@ -59,7 +59,32 @@ class TemporaryBedLevelingState {
 
 #if HAS_MESH
 
-  typedef float bed_mesh_t[GRID_MAX_POINTS_X][GRID_MAX_POINTS_Y];
+  #if ENABLED(COMPACT_MESH_Z)
+
+    /**
+     * A mesh Z value held as whole microns, converted to and from float
+     * when read and written. Uses the same form as OPTIMIZED_MESH_STORAGE.
+     */
+    class mesh_z_t {
+      int16_t um;
+    public:
+      static constexpr int16_t um_nan = INT16_MAX;
+      operator float() const { return um == um_nan ? NAN : um * 0.001f; }
+      mesh_z_t& operator=(const_float_t z) {
+        um = isnan(z) ? um_nan : int16_t(constrain(LROUND(z * 1000), -(um_nan - 1), um_nan - 1));
+        return *this;
+      }
+      mesh_z_t& operator+=(const_float_t dz) { return *this = float(*this) + dz; }
+      mesh_z_t& operator-=(const_float_t dz) { return *this = float(*this) - dz; }
+    };
+
+    typedef mesh_z_t bed_mesh_t[GRID_MAX_POINTS_X][GRID_MAX_POINTS_Y];
+
+  #else
+
+    typedef float bed_mesh_t[GRID_MAX_POINTS_X][GRID_MAX_POINTS_Y];
+
+  #endif
 
   #if ENABLED(AUTO_BED_LEVELING_BILINEAR)
     #include "abl/bbl.h"
@@ -78,7 +103,8 @@ class TemporaryBedLevelingState {
     /**
      * Print calibration results for plotting or manual frame adjustment.
      */
-    void print_2d_array(const uint8_t sx, const uint8_t sy, const uint8_t precision, const float *values);
+    template<typename T>
+    void print_2d_array(const uint8_t sx, const uint8_t sy, const uint8_t precision, const T *values);
 
   #endif
 
@@ -96,4 +122,31 @@ class TemporaryBedLevelingState {
     operator const xy_int8_t&() const { return pos; }
   };
 
+  #if ENABLED(ADAPTIVE_MESH)
+
+    /**
+     * The area of the next print, set by M555 or the header of an SD file.
+     * The next G29 probes only the mesh points around it.
+     */
+    class PrintArea {
+    public:
+      static bool valid;                      // Set for the next G29
+      static xy_pos_t min, max;               // Logical position of the print
+      static bool limit;                      // G29 is probing only the selected points
+      static xy_uint8_t grid_min, grid_max;   // The selected points
+
+      static void set(const xy_pos_t &lo, const xy_pos_t &hi) { min = lo; max = hi; valid = true; }
+      static void reset() { valid = limit = false; }
+
+      static void select_grid(const xy_pos_t &start, const xy_float_t &spacing);
+      static bool grid_contains(const uint8_t x, const uint8_t y) {
+        return !limit || (WITHIN(x, grid_min.x, grid_max.x) && WITHIN(y, grid_min.y, grid_max.y));
+      }
+      static void fill_outside(bed_mesh_t &z);
+    };
+
+    extern PrintArea print_area;
+
+  #endif
+
 #endif
@@ -0,0 +1,92 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../../inc/MarlinConfig.h"
+
+#if ENABLED(ABL_PROBE_TOUR)
+
+#include "probe_tour.h"
+
+uint8_t probe_tour::count, probe_tour::index[GRID_MAX_POINTS], probe_tour::size_x;
+xy_pos_t probe_tour::lf;
+xy_float_t probe_tour::spacing;
+
+void probe_tour::reset(const xy_pos_t &_lf, const xy_float_t &_spacing, const uint8_t _size_x) {
+  lf = _lf;
+  spacing = _spacing;
+  size_x = _size_x;
+  count = 0;
+}
+
+float probe_tour::length(const xy_pos_t &from) {
+  float total = 0;
+  xy_pos_t p = from;
+  for (uint8_t i = 0; i < count; ++i) {
+    const xy_pos_t q = pos(i);
+    total += (q - p).magnitude();
+    p = q;
+  }
+  return total;
+}
+
+float probe_tour::optimize(const xy_pos_t &from) {
+  // Nearest neighbor, taking the earliest of equally near points
+  xy_pos_t p = from;
+  for (uint8_t i = 0; i < count; ++i) {
+    uint8_t best = i;
+    float best_d = (pos(i) - p).magnitude();
+    for (uint8_t j = i + 1; j < count; ++j) {
+      const float d = (pos(j) - p).magnitude();
+      if (d < best_d - 0.001f) { best = j; best_d = d; }
+    }
+    const uint8_t t = index[i]; index[i] = index[best]; index[best] = t;
+    p = pos(i);
+  }
+
+  // 2-opt on the open path. Reversing the stretch i..j replaces the edges
+  // (i-1,i) and (j,j+1) with (i-1,j) and (i,j+1). The start stays fixed.
+  for (uint8_t pass = 0; pass < 10; ++pass) {
+    bool improved = false;
+    for (uint8_t i = 0; i + 1 < count; ++i) {
+      const xy_pos_t a = i ? pos(i - 1) : from;
+      for (uint8_t j = i + 1; j < count; ++j) {
+        const xy_pos_t b = pos(i), c = pos(j);
+        float gain = (b - a).magnitude() - (c - a).magnitude();
+        if (j + 1 < count) {
+          const xy_pos_t d = pos(j + 1);
+          gain += (d - c).magnitude() - (d - b).magnitude();
+        }
+        if (gain > 0.01f) {
+          for (uint8_t l = i, r = j; l < r; ++l, --r) {
+            const uint8_t t = index[l]; index[l] = index[r]; index[r] = t;
+          }
+          improved = true;
+        }
+      }
+    }
+    if (!improved) break;
+  }
+
+  return length(from);
+}
+
+#endif // ABL_PROBE_TOUR
@@ -0,0 +1,60 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * probe_tour.h - Short-travel probing order for a set of grid points
+ *
+ * The points to probe are added in their default (zig-zag) order. The tour
+ * is then rebuilt by nearest neighbor from the current probe position and
+ * refined with 2-opt, reversing any stretch of the tour that shortens it.
+ *
+ * Every point costs the same Z raise and descent in any order, so only the
+ * XY travel between points is minimized. The probe XY offset only moves the
+ * start of the tour, which is the current probe position.
+ */
+
+#include "../../inc/MarlinConfigPre.h"
+#include "../../core/types.h"
+
+class probe_tour {
+  public:
+    static uint8_t count;                   // Number of points to probe
+    static uint8_t index[GRID_MAX_POINTS];  // Points as x + y * grid size x, in probing order
+
+    static void reset(const xy_pos_t &lf, const xy_float_t &spacing, const uint8_t size_x);
+    static void add(const uint8_t x, const uint8_t y) { index[count++] = x + y * size_x; }
+
+    static xy_int8_t grid(const uint8_t i) { return { int8_t(index[i] % size_x), int8_t(index[i] / size_x) }; }
+    static xy_pos_t pos(const uint8_t i) { return lf + spacing * grid(i).asFloat(); }
+
+    // XY travel from a probe position through the tour
+    static float length(const xy_pos_t &from);
+
+    // Reorder for less travel from a probe position. Return the new length.
+    static float optimize(const xy_pos_t &from);
+
+  private:
+    static xy_pos_t lf;
+    static xy_float_t spacing;
+    static uint8_t size_x;
+};
@@ -41,6 +41,10 @@ unified_bed_leveling bedlevel;
   #include "../../../lcd/extui/ui_api.h"
 #endif
 
+#if BOTH(UBL_CELL_CACHE, MARLIN_TEST_BUILD)
+  #include "../../../tests/test_helpers.h"
+#endif
+
 #include "math.h"
 
 void unified_bed_leveling::echo_name() { SERIAL_ECHOPGM("Unified Bed Leveling"); }
@@ -52,7 +56,7 @@ void unified_bed_leveling::report_current_mesh() {
     if (!isnan(z_values[x][y])) {
       SERIAL_ECHO_START();
       SERIAL_ECHOPGM("  M421 I", x, " J", y);
-      SERIAL_ECHOLNPAIR_F_P(SP_Z_STR, z_values[x][y], 4);
+      SERIAL_ECHOLNPAIR_F_P(SP_Z_STR, float(z_values[x][y]), 4);
       serial_delay(75); // Prevent Printrun from exploding
     }
 }
@@ -65,7 +69,7 @@ void unified_bed_leveling::report_state() {
 
 int8_t unified_bed_leveling::storage_slot;
 
-float unified_bed_leveling::z_values[GRID_MAX_POINTS_X][GRID_MAX_POINTS_Y];
+bed_mesh_t unified_bed_leveling::z_values;
 
 #if DISABLED(JYENHANCED)
   #define _GRIDPOS(A,N) (MESH_MIN_##A + N * (MESH_##A##_DIST))
@@ -87,6 +91,81 @@ float unified_bed_leveling::z_values[GRID_MAX_POINTS_X][GRID_MAX_POINTS_Y];
 
 volatile int16_t unified_bed_leveling::encoder_diff;
 
+#if ENABLED(UBL_CELL_CACHE)
+
+  mesh_cell_t unified_bed_leveling::cell_cache[UBL_CELL_CACHE_SIZE];
+
+  /**
+   * Get the bilinear coefficients of mesh cell 'c' into a cache entry
+   */
+  void unified_bed_leveling::fill_cell(mesh_cell_t &m, const xy_int8_t &c) {
+    float z00 = z_values[c.x][c.y], z10 = z_values[c.x + 1][c.y],
+          z01 = z_values[c.x][c.y + 1], z11 = z_values[c.x + 1][c.y + 1];
+
+    m.valid = !isnan(z00) && !isnan(z10) && !isnan(z01) && !isnan(z11);
+    if (isnan(z00)) z00 = 0;
+    if (isnan(z10)) z10 = 0;
+    if (isnan(z01)) z01 = 0;
+    if (isnan(z11)) z11 = 0;
+
+    m.cell = c;
+    m.origin.set(get_mesh_x(c.x), get_mesh_y(c.y));
+    m.z0 = z00;
+    m.dzx = (z10 - z00) * RECIPROCAL(MESH_X_DIST);
+    m.dzy = (z01 - z00) * RECIPROCAL(MESH_Y_DIST);
+    m.dzxy = (z11 - z01 - z10 + z00) * RECIPROCAL(MESH_X_DIST) * RECIPROCAL(MESH_Y_DIST);
+  }
+
+  #if ENABLED(MARLIN_TEST_BUILD)
+
+    /**
+     * Fill the mesh with a test surface and compare the cached cell interpolation
+     * to the interpolation straight from the mesh, reporting the interpolations per
+     * second of each for points 1mm apart along rows across the mesh. Both compute
+     * the same bilinear surface, so they must agree to within float rounding (0.1um).
+     * The mesh is restored afterward.
+     */
+    void test_ubl_cell_cache() {
+      bed_mesh_t saved_z;
+      COPY(saved_z, bedlevel.z_values);
+      GRID_LOOP(x, y) bedlevel.z_values[x][y] = 0.1f * sin(x * 1.3f + y * 0.7f) - 0.002f * x * y;
+      bedlevel.refresh_bed_level();
+
+      const uint16_t row_points = MESH_MAX_X - (MESH_MIN_X) + 1, rows = MESH_MAX_Y - (MESH_MIN_Y) + 1;
+      auto test_point = [row_points, rows](const uint32_t i) -> xy_pos_t {
+        return { MESH_MIN_X + float(i % row_points), MESH_MIN_Y + float((i / row_points) % rows) };
+      };
+
+      auto direct = [](const xy_pos_t &p) {
+        const xy_int8_t c = bedlevel.cell_indexes(p);
+        return bedlevel.mesh_cell_z(p.x, p.y, c.x, c.y);
+      };
+      auto cached = [](const xy_pos_t &p) {
+        const xy_int8_t c = bedlevel.cell_indexes(p);
+        return bedlevel.cached_cell_z(p.x, p.y, c.x, c.y);
+      };
+
+      auto rate = [&test_point](float (*interpolate)(const xy_pos_t&)) {
+        return test_calls_per_second([&](const uint32_t i) { test_keep(interpolate(test_point(i))); });
+      };
+
+      float worst = 0;
+      for (uint32_t i = 0; i < uint32_t(row_points) * rows; ++i) {
+        const xy_pos_t p = test_point(i);
+        NOLESS(worst, ABS(cached(p) - direct(p)));
+      }
+
+      SERIAL_ECHOLNPGM("UBL Z interpolations per second, direct: ", rate(direct), " cell cache: ", rate(cached));
+      test_max_error(F("UBL cell cache max difference"), worst * 1000, 0.1f, F("um"));
+
+      COPY(bedlevel.z_values, saved_z);
+      bedlevel.refresh_bed_level();
+    }
+
+  #endif
+
+#endif // UBL_CELL_CACHE
+
 unified_bed_leveling::unified_bed_leveling() { reset(); }
 
 void unified_bed_leveling::reset() {
@@ -94,6 +173,7 @@ void unified_bed_leveling::reset() {
   set_bed_leveling_enabled(false);
   storage_slot = -1;
   ZERO(z_values);
+  refresh_bed_level();
   #if ENABLED(EXTENSIBLE_UI)
     GRID_LOOP(x, y) ExtUI::onMeshUpdate(x, y, 0);
   #endif
@@ -110,6 +190,7 @@ void unified_bed_leveling::set_all_mesh_points_to_value(const_float_t value) {
     z_values[x][y] = value;
     TERN_(EXTENSIBLE_UI, ExtUI::onMeshUpdate(x, y, value));
   }
+  refresh_bed_level();
 }
 
 #if ENABLED(OPTIMIZED_MESH_STORAGE)
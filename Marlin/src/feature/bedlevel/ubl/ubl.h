@@ -45,6 +45,17 @@ struct mesh_index_pair;
   typedef int16_t mesh_store_t[GRID_MAX_POINTS_X][GRID_MAX_POINTS_Y];
 #endif
 
+#if ENABLED(UBL_CELL_CACHE)
+  // Bilinear interpolation over one mesh cell, relative to its front left point:
+  // Z = z0 + dzx * x + dzy * y + dzxy * x * y
+  typedef struct {
+    xy_int8_t cell;             // The cached cell, -1 if unused
+    bool valid;                 // All four corners are probed. Unprobed corners are taken as 0.
+    xy_pos_t origin;            // Position of the front left point
+    float z0, dzx, dzy, dzxy;
+  } mesh_cell_t;
+#endif
+
 typedef struct {
   bool      C_seen;
   int8_t    KLS_storage_slot;
@@ -84,6 +95,11 @@ private:
     return smart_fill_one(pos.x, pos.y, dir.x, dir.y);
   }
 
+  #if ENABLED(UBL_CELL_CACHE)
+    static mesh_cell_t cell_cache[UBL_CELL_CACHE_SIZE];
+    static void fill_cell(mesh_cell_t &m, const xy_int8_t &c);
+  #endif
+
   #if ENABLED(UBL_DEVEL_DEBUGGING)
     static void g29_what_command();
     static void g29_eeprom_dump();
@@ -134,7 +150,23 @@ public:
 
   unified_bed_leveling();
 
-  FORCE_INLINE static void set_z(const int8_t px, const int8_t py, const_float_t z) { z_values[px][py] = z; }
+  FORCE_INLINE static void set_z(const int8_t px, const int8_t py, const_float_t z) { z_values[px][py] = z; refresh_bed_level(); }
+
+  // Refresh after z_values have been changed
+  static void refresh_bed_level() {
+    #if ENABLED(UBL_CELL_CACHE)
+      for (uint8_t i = 0; i < UBL_CELL_CACHE_SIZE; ++i) cell_cache[i].cell.x = -1;
+    #endif
+  }
+
+  #if ENABLED(UBL_CELL_CACHE)
+    // Get the interpolation of a mesh cell, setting it up if it isn't cached
+    FORCE_INLINE static const mesh_cell_t& get_cell(const xy_int8_t &c) {
+      mesh_cell_t &m = cell_cache[(c.x + 2 * c.y) & ((UBL_CELL_CACHE_SIZE) - 1)]; // Neighboring cells use different entries
+      if (m.cell != c) fill_cell(m, c);
+      return m;
+    }
+  #endif
 
   static int8_t cell_index_x_raw(const_float_t x) {
     return FLOOR((x - (MESH_MIN_X)) * RECIPROCAL(MESH_X_DIST));
@@ -250,10 +282,29 @@ public:
   }
 
   /**
-   * This is the generic Z-Correction. It works anywhere within a Mesh Cell. It first
-   * does a linear interpolation along both of the bounding X-Mesh-Lines to find the
-   * Z-Height at both ends. Then it does a linear interpolation of these heights based
-   * on the Y position within the cell.
+   * Interpolate Z in mesh cell 'cx, cy'. First do a linear interpolation along both
+   * of the bounding X-Mesh-Lines to find the Z-Height at both ends. Then do a linear
+   * interpolation of these heights based on the Y position within the cell.
+   */
+  static float mesh_cell_z(const_float_t rx0, const_float_t ry0, const int8_t cx, const int8_t cy) {
+    const uint8_t mx = _MIN(cx, (GRID_MAX_POINTS_X) - 2) + 1, my = _MIN(cy, (GRID_MAX_POINTS_Y) - 2) + 1;
+    const float x0 = get_mesh_x(cx), x1 = get_mesh_x(cx + 1),
+                z1 = calc_z0(rx0, x0, z_values[cx][cy], x1, z_values[mx][cy]),
+                z2 = calc_z0(rx0, x0, z_values[cx][my], x1, z_values[mx][my]);
+    return calc_z0(ry0, get_mesh_y(cy), z1, get_mesh_y(cy + 1), z2);
+  }
+
+  #if ENABLED(UBL_CELL_CACHE)
+    // The same from the cached interpolation of the cell, without divisions
+    static float cached_cell_z(const_float_t rx0, const_float_t ry0, const int8_t cx, const int8_t cy) {
+      const mesh_cell_t &m = get_cell({ cx, cy });
+      const float x = rx0 - m.origin.x, y = ry0 - m.origin.y;
+      return m.valid ? m.z0 + m.dzx * x + (m.dzy + m.dzxy * x) * y : NAN;
+    }
+  #endif
+
+  /**
+   * This is the generic Z-Correction. It works anywhere within a Mesh Cell.
    */
   static float get_z_correction(const_float_t rx0, const_float_t ry0) {
     const int8_t cx = cell_index_x(rx0), cy = cell_index_y(ry0); // return values are clamped
@@ -267,11 +318,7 @@ public:
         return UBL_Z_RAISE_WHEN_OFF_MESH;
     #endif
 
-    const uint8_t mx = _MIN(cx, (GRID_MAX_POINTS_X) - 2) + 1, my = _MIN(cy, (GRID_MAX_POINTS_Y) - 2) + 1,
-                  x0 = get_mesh_x(cx), x1 = get_mesh_x(cx + 1);
-    const float z1 = calc_z0(rx0, x0, z_values[cx][cy], x1, z_values[mx][cy]),
-                z2 = calc_z0(rx0, x0, z_values[cx][my], x1, z_values[mx][my]);
-    float z0 = calc_z0(ry0, get_mesh_y(cy), z1, get_mesh_y(cy + 1), z2);
+    float z0 = TERN(UBL_CELL_CACHE, cached_cell_z, mesh_cell_z)(rx0, ry0, cx, cy);
 
     if (isnan(z0)) { // If part of the Mesh is undefined, it will show up as NAN
       z0 = 0.0;      // in z_values[][] and propagate through the calculations.
@@ -320,5 +367,9 @@ public:
 
 extern unified_bed_leveling bedlevel;
 
+#if BOTH(UBL_CELL_CACHE, MARLIN_TEST_BUILD)
+  void test_ubl_cell_cache();
+#endif
+
 // Prevent debugging propagating to other files
 #include "../../../core/debug_out.h"
@@ -381,6 +381,7 @@ void unified_bed_leveling::G29() {
     else
       SERIAL_ECHOPGM("Locations");
     SERIAL_ECHOLNPGM(" invalidated.\n");
+    refresh_bed_level();  // Before any error return below
   }
 
   if (parser.seen('Q')) {
@@ -425,6 +426,7 @@ void unified_bed_leveling::G29() {
           }
         break;
     }
+    refresh_bed_level();
   }
 
   #if HAS_BED_PROBE
@@ -432,6 +434,7 @@ void unified_bed_leveling::G29() {
     if (parser.seen_test('J')) {
       save_ubl_active_state_and_disable();
       tilt_mesh_based_on_probed_grid(param.J_grid_size == 0); // Zero size does 3-Point
+      refresh_bed_level();
       restore_ubl_active_state_and_leave();
       #if ENABLED(UBL_G29_J_RECENTER)
         do_blocking_move_to_xy(0.5f * ((MESH_MIN_X) + (MESH_MAX_X)), 0.5f * ((MESH_MIN_Y) + (MESH_MAX_Y)));
@@ -463,6 +466,21 @@ void unified_bed_leveling::G29() {
           //
           // Invalidate Entire Mesh and Automatically Probe Mesh in areas that can be reached by the probe
           //
+          #if ENABLED(ADAPTIVE_MESH)
+            // With a print area invalidate and probe only the points around it
+            if (print_area.valid) {
+              print_area.select_grid({ MESH_MIN_X, MESH_MIN_Y }, { MESH_X_DIST, MESH_Y_DIST });
+              if (!parser.seen_test('C')) {
+                GRID_LOOP(x, y) if (print_area.grid_contains(x, y)) {
+                  z_values[x][y] = NAN;
+                  TERN_(EXTENSIBLE_UI, ExtUI::onMeshUpdate(x, y, 0));
+                }
+                SERIAL_ECHOLNPGM("Print area invalidated. Probing mesh points X", print_area.grid_min.x, "-", print_area.grid_max.x,
+                                 " Y", print_area.grid_min.y, "-", print_area.grid_max.y, ".");
+              }
+            }
+            else
+          #endif
           if (!parser.seen_test('C')) {
             invalidate();
             SERIAL_ECHOLNPGM("Mesh invalidated. Probing mesh.");
@@ -475,6 +493,11 @@ void unified_bed_leveling::G29() {
           }
           probe_entire_mesh(param.XY_pos, parser.seen_test('T'), parser.seen_test('E'), parser.seen_test('U'));
 
+          #if ENABLED(ADAPTIVE_MESH)
+            print_area.fill_outside(z_values); // Fill points with no stored height around the probed area
+            print_area.reset();                // The print area is only used once
+          #endif
+
           report_current_position();
           probe_deployed = true;
         } break;
@@ -606,6 +629,7 @@ void unified_bed_leveling::G29() {
 
       case 6: shift_mesh_height(); break;
     }
+    refresh_bed_level();
   }
 
   #if ENABLED(UBL_DEVEL_DEBUGGING)
@@ -685,6 +709,8 @@ void unified_bed_leveling::G29() {
 
   LEAVE:
 
+  refresh_bed_level();
+
   #if HAS_MARLINUI_MENU
     ui.reset_alert_level();
     ui.quick_feedback();
@@ -1093,6 +1119,7 @@ void set_message_with_feedback(FSTR_P const fstr) {
       // TODO: Disable leveling here so the Z value becomes the 'native' Z value.
 
       z_values[lpos.x][lpos.y] = new_z;                   // Save the updated Z value
+      refresh_bed_level();
 
       // TODO: Re-enable leveling here so Z is correctly based on the updated mesh.
 
@@ -1331,6 +1358,7 @@ mesh_index_pair unified_bed_leveling::find_furthest_invalid_mesh_point() {
 
   static bool test_func(uint8_t i, uint8_t j, void *data) {
     find_closest_t *d = (find_closest_t*)data;
+    if (TERN0(ADAPTIVE_MESH, d->type == INVALID && !print_area.grid_contains(i, j))) return false;
     if (  d->type == CLOSEST || d->type == (isnan(bedlevel.z_values[i][j]) ? INVALID : REAL)
       || (d->type == SET_IN_BITMAP && !d->done_flags->marked(i, j))
     ) {
@@ -1375,6 +1403,9 @@ mesh_index_pair unified_bed_leveling::find_closest_mesh_point_of_type(const Mesh
     float best_so_far = 99999.99f;
 
     GRID_LOOP(i, j) {
+      // While probing around the print area skip other unprobed points
+      if (TERN0(ADAPTIVE_MESH, type == INVALID && !print_area.grid_contains(i, j))) continue;
+
       if (  type == CLOSEST || type == (isnan(z_values[i][j]) ? INVALID : REAL)
         || (type == SET_IN_BITMAP && !done_flags->marked(i, j))
       ) {
@@ -1882,7 +1913,7 @@ void unified_bed_leveling::smart_fill_mesh() {
 
     param.KLS_storage_slot = (int8_t)parser.value_int();
 
-    float tmp_z_values[GRID_MAX_POINTS_X][GRID_MAX_POINTS_Y];
+    bed_mesh_t tmp_z_values;
     settings.load_mesh(param.KLS_storage_slot, &tmp_z_values);
 
     SERIAL_ECHOLNPGM("Subtracting mesh in slot ", param.KLS_storage_slot, " from current mesh.");
@@ -0,0 +1,110 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2023 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../inc/MarlinConfig.h"
+
+#if ENABLED(SEGMENT_COALESCING)
+
+#include "coalescer.h"
+#include "../module/planner.h"
+
+SegmentCoalescer coalescer;
+
+bool SegmentCoalescer::enabled; // Initialized by settings.load()
+float SegmentCoalescer::tolerance;
+uint32_t SegmentCoalescer::merged; // = 0
+
+bool SegmentCoalescer::pending; // = false
+xyze_pos_t SegmentCoalescer::start, SegmentCoalescer::end;
+xyz_pos_t SegmentCoalescer::points[COALESCE_MAX_SEGMENTS - 1];
+uint8_t SegmentCoalescer::count;
+feedRate_t SegmentCoalescer::fr_mm_s;
+uint8_t SegmentCoalescer::extruder;
+float SegmentCoalescer::e_per_mm;
+
+// Squared distance of the end of 'v' from the line along unit vector 'u'
+static float off_line_sq(const xyz_float_t &v, const xyz_float_t &u) {
+  float vu = 0, vv = 0;
+  LOOP_NUM_AXES(i) { vu += v[i] * u[i]; vv += sq(v[i]); }
+  return vv - sq(vu);
+}
+
+void SegmentCoalescer::add(const xyze_pos_t &from, const xyze_pos_t &target, const_feedRate_t fr) {
+  const xyz_pos_t &p0 = from, &p1 = target;
+  const xyz_float_t seg = p1 - p0;
+  const float seg_mm = seg.magnitude();
+
+  // Only short moves with some axis motion are merged
+  if (!enabled || !seg_mm || seg_mm > (COALESCE_MAX_SEGMENT_MM)) {
+    flush();
+    planner.buffer_line(target, fr);
+    return;
+  }
+
+  const float seg_e_per_mm = TERN0(HAS_EXTRUDERS, (target.e - from.e) / seg_mm);
+
+  if (pending) {
+    bool merge = count < COALESCE_MAX_SEGMENTS - 1 && fr == fr_mm_s && extruder == active_extruder && from == end
+              && ABS(seg_e_per_mm - e_per_mm) <= (COALESCE_E_RATIO) * ABS(e_per_mm);
+    if (merge) {
+      // Every point joining two segments must stay close to the merged line
+      const xyz_pos_t &s = start, &e = end;
+      const xyz_float_t chord = p1 - s, u = chord / chord.magnitude();
+      const float tol_sq = sq(tolerance);
+      merge = off_line_sq(e - s, u) <= tol_sq;
+      for (uint8_t i = 0; merge && i < count; ++i)
+        merge = off_line_sq(points[i] - s, u) <= tol_sq;
+
+      // ...and the new segment must keep going the same way
+      float ahead = 0;
+      LOOP_NUM_AXES(i) ahead += seg[i] * u[i];
+      if (ahead <= 0) merge = false;
+    }
+    if (merge) {
+      points[count++] = end;
+      end = target;
+      merged++;
+      return;
+    }
+    _flush();
+  }
+
+  // Start a new run with this move
+  start = from;
+  end = target;
+  fr_mm_s = fr;
+  extruder = active_extruder;
+  e_per_mm = seg_e_per_mm;
+  count = 0;
+  pending = true;
+}
+
+void SegmentCoalescer::_flush() {
+  pending = false;
+  planner.buffer_line(end, fr_mm_s, extruder);
+}
+
+void SegmentCoalescer::task() {
+  if (pending && planner.movesplanned() < 2) _flush();
+}
+
+#endif // SEGMENT_COALESCING
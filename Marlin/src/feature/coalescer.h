@@ -0,0 +1,72 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2023 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * Segment Coalescing
+ *
+ * Merge runs of short G0/G1 moves that lie along a nearly straight line
+ * with a steady extrusion rate into a single planner move. Each merged
+ * segment saves a planner block, a planner recalculation, and a block
+ * setup in the Stepper ISR.
+ *
+ * The current run is held here until a move arrives that can't be merged,
+ * a command other than G0/G1 is processed, or the planner runs low.
+ */
+
+#include "../inc/MarlinConfigPre.h"
+#include "../core/types.h"
+
+class SegmentCoalescer {
+  public:
+    static bool enabled;                // M494 S
+    static float tolerance;             // (mm) M494 T - Maximum distance of a merged point from the merged line
+    static uint32_t merged;             // Segments merged into the previous move since startup or 'M494 R'
+
+    // Queue a line move, merging it into the current run if possible
+    static void add(const xyze_pos_t &start, const xyze_pos_t &target, const_feedRate_t fr_mm_s);
+
+    // Send the current run to the planner
+    static void flush() { if (pending) _flush(); }
+
+    // Drop the current run, e.g., on quick stop
+    static void discard() { pending = false; }
+
+    // A run is waiting to be sent to the planner
+    static bool busy() { return pending; }
+
+    // Don't hold a run back while the planner is running dry. Called from idle().
+    static void task();
+
+  private:
+    static bool pending;
+    static xyze_pos_t start, end;       // The merged line
+    static xyz_pos_t points[COALESCE_MAX_SEGMENTS - 1]; // Joints between the merged segments
+    static uint8_t count;               // Number of joints
+    static feedRate_t fr_mm_s;
+    static uint8_t extruder;
+    static float e_per_mm;              // Extrusion rate of the run
+
+    static void _flush();
+};
+
+extern SegmentCoalescer coalescer;
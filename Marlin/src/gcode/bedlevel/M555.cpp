@@ -0,0 +1,57 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../../inc/MarlinConfig.h"
+
+#if ENABLED(ADAPTIVE_MESH)
+
+#include "../gcode.h"
+#include "../../feature/bedlevel/bedlevel.h"
+
+/**
+ * M555: Set the print area for the next G29
+ *
+ *   X<pos>   Left edge of the print
+ *   Y<pos>   Front edge of the print
+ *   W<size>  Width of the print
+ *   H<size>  Depth of the print
+ *
+ * With no parameters report the print area.
+ */
+void GcodeSuite::M555() {
+  if (parser.seen("XYWH")) {
+    const xy_pos_t lo = { parser.linearval('X'), parser.linearval('Y') },
+                   size = { parser.linearval('W'), parser.linearval('H') };
+    if (size.x < 0 || size.y < 0) {
+      SERIAL_ECHOLNPGM("?(W)idth and (H)eight can't be negative.");
+      return;
+    }
+    print_area.set(lo, lo + size);
+  }
+  else if (print_area.valid)
+    SERIAL_ECHOLNPGM("Print area X", print_area.min.x, " Y", print_area.min.y,
+                     " W", print_area.max.x - print_area.min.x, " H", print_area.max.y - print_area.min.y);
+  else
+    SERIAL_ECHOLNPGM("No print area");
+}
+
+#endif // ADAPTIVE_MESH
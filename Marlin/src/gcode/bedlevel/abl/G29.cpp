@@ -58,6 +58,14 @@
   #include "../../../module/tool_change.h"
 #endif
 
+#if ENABLED(BD_SENSOR_FLYING_SCAN)
+  #include "../../../feature/bedlevel/bdl/bdl.h"
+#endif
+
+#if ENABLED(ABL_PROBE_TOUR)
+  #include "../../../feature/bedlevel/probe_tour.h"
+#endif
+
 #define DEBUG_OUT ENABLED(DEBUG_LEVELING_FEATURE)
 #include "../../../core/debug_out.h"
 
@@ -226,6 +234,12 @@ public:
  *  E  By default G29 will engage the Z probe, test the bed, then disengage.
  *     Include "E" to engage/disengage the Z probe for each sample.
  *     There's no extra effect if you have a fixed Z probe.
+ *
+ * With ABL_PROBE_TOUR the grid points are probed in a short-travel order.
+ * "G29 V1" reports the planned and actual travel.
+ *
+ * With BD_SENSOR_FLYING_SCAN the grid is measured with the Bed Distance Sensor
+ * in continuous rows, without stopping at each point.
  */
 G29_TYPE GcodeSuite::G29() {
   DEBUG_SECTION(log_G29, "G29", DEBUGGING(LEVELING));
@@ -516,7 +530,19 @@ G29_TYPE GcodeSuite::G29() {
       }
 
       // Pre-populate local Z values from the stored mesh
-      TERN_(IS_KINEMATIC, COPY(abl.z_values, bedlevel.z_values));
+      #if EITHER(IS_KINEMATIC, ADAPTIVE_MESH)
+        COPY(abl.z_values, bedlevel.z_values);
+      #endif
+
+      // Probe only the points around the print area, keeping the rest
+      #if ENABLED(ADAPTIVE_MESH)
+        if (print_area.valid) {
+          print_area.select_grid(abl.probe_position_lf, abl.gridSpacing);
+          if (abl.verbose_level)
+            SERIAL_ECHOLNPGM("Print area mesh points X", print_area.grid_min.x, "-", print_area.grid_max.x,
+                             " Y", print_area.grid_min.y, "-", print_area.grid_max.y);
+        }
+      #endif
 
     #endif // AUTO_BED_LEVELING_BILINEAR
 
@@ -675,51 +701,49 @@ G29_TYPE GcodeSuite::G29() {
 
       bool zig = PR_OUTER_SIZE & 1;  // Always end at RIGHT and BACK_PROBE_BED_POSITION
 
-      // Outer loop is X with PROBE_Y_FIRST enabled
-      // Outer loop is Y with PROBE_Y_FIRST disabled
-      for (PR_OUTER_VAR = 0; PR_OUTER_VAR < PR_OUTER_SIZE && !isnan(abl.measured_z); PR_OUTER_VAR++) {
-
-        int8_t inStart, inStop, inInc;
-
-        TERN_(JYENHANCED, if (temp_val.cancel_lev) break; );
-
-        if (zig) {                      // Zig away from origin
-          inStart = 0;                  // Left or front
-          inStop = PR_INNER_SIZE;       // Right or back
-          inInc = 1;                    // Zig right
-        }
-        else {                          // Zag towards origin
-          inStart = PR_INNER_SIZE - 1;  // Right or back
-          inStop = -1;                  // Left or front
-          inInc = -1;                   // Zag left
+      #if ENABLED(BD_SENSOR_FLYING_SCAN)
+        // Scan the whole grid in one pass instead of stopping at each point
+        if (!faux) {
+          if (bdl.scan_grid(abl.probe_position_lf, abl.gridSpacing, abl.z_values, abl.verbose_level)) {
+            GRID_LOOP(x, y) {
+              abl.z_values[x][y] += abl.Z_offset;
+              TERN_(EXTENSIBLE_UI, ExtUI::onMeshUpdate(x, y, abl.z_values[x][y]));
+            }
+            abl.reenable = false; // Don't re-enable after modifying the mesh
+          }
+          else {
+            set_bed_leveling_enabled(abl.reenable);
+            abl.measured_z = NAN;
+          }
         }
+        else
+      #endif
 
-        zig ^= true; // zag
-
-        // An index to print current state
-        uint8_t pt_index = (PR_OUTER_VAR) * (PR_INNER_SIZE) + 1;
-
-        // Inner loop is Y with PROBE_Y_FIRST enabled
-        // Inner loop is X with PROBE_Y_FIRST disabled
-        for (PR_INNER_VAR = inStart; PR_INNER_VAR != inStop; pt_index++, PR_INNER_VAR += inInc) {
+      {
+        #if ENABLED(ABL_PROBE_TOUR)
+          float travel = 0;
+        #endif
 
+        // Probe the grid point at abl.meshCount. Return false on failure.
+        auto probe_grid_point = [&](const uint8_t pt_index) {
           abl.probePos = abl.probe_position_lf + abl.gridSpacing * abl.meshCount.asFloat();
 
-          TERN_(AUTO_BED_LEVELING_LINEAR, abl.indexIntoAB[abl.meshCount.x][abl.meshCount.y] = ++abl.abl_probe_index); // 0...
-
-          // Avoid probing outside the round or hexagonal area
-          if (TERN0(IS_KINEMATIC, !probe.can_reach(abl.probePos))) continue;
-
           if (abl.verbose_level) SERIAL_ECHOLNPGM("Probing mesh point ", pt_index, "/", abl.abl_points, ".");
           TERN_(HAS_STATUS_MESSAGE, ui.status_printf(0, F(S_FMT " %i/%i"), GET_TEXT(MSG_PROBING_POINT), int(pt_index), int(abl.abl_points)));
 
+          #if ENABLED(ABL_PROBE_TOUR)
+            const xy_pos_t was = current_position;
+          #endif
+
           abl.measured_z = faux ? 0.001f * random(-100, 101) : probe.probe_at_point(abl.probePos, raise_after, abl.verbose_level);
 
           if (isnan(abl.measured_z)) {
             set_bed_leveling_enabled(abl.reenable);
-            break; // Breaks out of both loops
+            return false;
           }
 
+          TERN_(ABL_PROBE_TOUR, travel += (xy_pos_t(current_position) - was).magnitude());
+
           #if ENABLED(AUTO_BED_LEVELING_LINEAR)
 
             abl.mean += abl.measured_z;
@@ -740,10 +764,86 @@ G29_TYPE GcodeSuite::G29() {
 
           abl.reenable = false; // Don't re-enable after modifying the mesh
           idle_no_sleep();
-          TERN_(JYENHANCED, if (temp_val.cancel_lev) break; );
+          return true;
+        };
+
+        #if ENABLED(ABL_PROBE_TOUR)
+
+          // Collect the reachable points in zig-zag order, then shorten the tour
+          probe_tour::reset(abl.probe_position_lf, abl.gridSpacing, abl.grid_points.x);
+          for (PR_OUTER_VAR = 0; PR_OUTER_VAR < PR_OUTER_SIZE; PR_OUTER_VAR++, zig ^= true)
+            for (uint8_t n = 0; n < PR_INNER_SIZE; ++n) {
+              PR_INNER_VAR = zig ? n : PR_INNER_SIZE - 1 - n;
+              TERN_(AUTO_BED_LEVELING_LINEAR, abl.indexIntoAB[abl.meshCount.x][abl.meshCount.y] = abl.meshCount.x + abl.meshCount.y * abl.grid_points.x);
+              // Avoid probing outside the round or hexagonal area, or away from the print area
+              if (TERN1(IS_KINEMATIC, probe.can_reach(abl.probe_position_lf + abl.gridSpacing * abl.meshCount.asFloat()))
+                && TERN1(ADAPTIVE_MESH, print_area.grid_contains(abl.meshCount.x, abl.meshCount.y))
+              ) probe_tour::add(abl.meshCount.x, abl.meshCount.y);
+            }
+
+          const xy_pos_t tour_start = xy_pos_t(current_position) + probe.offset_xy;
+          const float zigzag_travel = probe_tour::length(tour_start),
+                      tour_travel = probe_tour::optimize(tour_start);
+          if (abl.verbose_level)
+            SERIAL_ECHOLNPGM("Probe tour: ", tour_travel, "mm (zig-zag ", zigzag_travel, "mm)");
+
+          for (uint8_t i = 0; i < probe_tour::count; ++i) {
+            TERN_(JYENHANCED, if (temp_val.cancel_lev) break; );
+            abl.meshCount = probe_tour::grid(i);
+            TERN_(AUTO_BED_LEVELING_LINEAR, abl.abl_probe_index = abl.indexIntoAB[abl.meshCount.x][abl.meshCount.y]);
+            if (!probe_grid_point(i + 1)) break;
+          }
+
+          if (abl.verbose_level && !isnan(abl.measured_z))
+            SERIAL_ECHOLNPGM("Probe travel: ", travel, "mm");
+
+        #else
+
+          // Outer loop is X with PROBE_Y_FIRST enabled
+          // Outer loop is Y with PROBE_Y_FIRST disabled
+          for (PR_OUTER_VAR = 0; PR_OUTER_VAR < PR_OUTER_SIZE && !isnan(abl.measured_z); PR_OUTER_VAR++) {
+
+            int8_t inStart, inStop, inInc;
+
+            TERN_(JYENHANCED, if (temp_val.cancel_lev) break; );
+
+            if (zig) {                      // Zig away from origin
+              inStart = 0;                  // Left or front
+              inStop = PR_INNER_SIZE;       // Right or back
+              inInc = 1;                    // Zig right
+            }
+            else {                          // Zag towards origin
+              inStart = PR_INNER_SIZE - 1;  // Right or back
+              inStop = -1;                  // Left or front
+              inInc = -1;                   // Zag left
+            }
+
+            zig ^= true; // zag
 
-        } // inner
-      } // outer
+            // An index to print current state
+            uint8_t pt_index = (PR_OUTER_VAR) * (PR_INNER_SIZE) + 1;
+
+            // Inner loop is Y with PROBE_Y_FIRST enabled
+            // Inner loop is X with PROBE_Y_FIRST disabled
+            for (PR_INNER_VAR = inStart; PR_INNER_VAR != inStop; pt_index++, PR_INNER_VAR += inInc) {
+
+              TERN_(AUTO_BED_LEVELING_LINEAR, abl.indexIntoAB[abl.meshCount.x][abl.meshCount.y] = ++abl.abl_probe_index); // 0...
+
+              // Avoid probing outside the round or hexagonal area
+              if (TERN0(IS_KINEMATIC, !probe.can_reach(abl.probe_position_lf + abl.gridSpacing * abl.meshCount.asFloat()))) continue;
+
+              // Probe only around the print area
+              if (TERN0(ADAPTIVE_MESH, !print_area.grid_contains(abl.meshCount.x, abl.meshCount.y))) continue;
+
+              if (!probe_grid_point(pt_index)) break; // Breaks out of both loops
+
+              TERN_(JYENHANCED, if (temp_val.cancel_lev) break; );
+
+            } // inner
+          } // outer
+
+        #endif // !ABL_PROBE_TOUR
+      }
 
     #elif ENABLED(AUTO_BED_LEVELING_3POINT)
 
@@ -805,6 +905,9 @@ G29_TYPE GcodeSuite::G29() {
   if (!isnan(abl.measured_z)) {
     #if ENABLED(AUTO_BED_LEVELING_BILINEAR)
 
+      // Fill points with no stored height around the probed print area
+      TERN_(ADAPTIVE_MESH, print_area.fill_outside(abl.z_values));
+
       if (abl.dryrun)
         bedlevel.print_leveling_grid(&abl.z_values);
       else {
@@ -943,6 +1046,9 @@ G29_TYPE GcodeSuite::G29() {
 
   } // !isnan(abl.measured_z)
 
+  // The print area is only used once
+  TERN_(ADAPTIVE_MESH, print_area.reset());
+
   // Restore state after probing
   if (!faux) restore_feedrate_and_scaling();
 
@@ -66,8 +66,9 @@ void GcodeSuite::M421() {
   else if (!WITHIN(ij.x, 0, GRID_MAX_POINTS_X - 1) || !WITHIN(ij.y, 0, GRID_MAX_POINTS_Y - 1))
     SERIAL_ERROR_MSG(STR_ERR_MESH_XY);
   else {
-    float &zval = bedlevel.z_values[ij.x][ij.y];                               // Altering this Mesh Point
-    zval = hasN ? NAN : parser.value_linear_units() + (hasQ ? zval : 0);  // N=NAN, Z=NEWVAL, or Q=ADDVAL
+    auto &zval = bedlevel.z_values[ij.x][ij.y];                                // Altering this Mesh Point
+    zval = hasN ? NAN : parser.value_linear_units() + (hasQ ? float(zval) : 0); // N=NAN, Z=NEWVAL, or Q=ADDVAL
+    bedlevel.refresh_bed_level();
     TERN_(EXTENSIBLE_UI, ExtUI::onMeshUpdate(ij.x, ij.y, zval));          // Ping ExtUI in case it's showing the mesh
     TERN_(DWIN_LCD_PROUI, DWIN_MeshUpdate(ij.x, ij.y, zval));
   }
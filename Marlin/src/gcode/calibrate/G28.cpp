@@ -46,6 +46,10 @@
 
 #include "../../module/probe.h"
 
+#if ENABLED(FT_MOTION)
+  #include "../../module/ft_motion.h"
+#endif
+
 #if ENABLED(BLTOUCH)
   #include "../../feature/bltouch.h"
 #endif
@@ -246,6 +250,9 @@ void GcodeSuite::G28() {
 
   planner.synchronize();          // Wait for planner moves to finish!
 
+  // Endstops are only checked by the trapezoid generator
+  TERN_(FT_MOTION, FTMotionDisableInScope FT_Disabler);
+
   SET_SOFT_ENDSTOP_LOOSE(false);  // Reset a leftover 'loose' motion state
 
   // Disable the leveling matrix before homing
@@ -354,6 +354,274 @@ static float auto_tune_a(const float dcr) {
   return a_fac;
 }
 
+#if ENABLED(DELTA_CALIBRATION_LEAST_SQUARES)
+
+  /**
+   * Least-squares calibration
+   *
+   * The carriage positions at each probe trigger are kept. For any trial set
+   * of parameters these give the effector height where the probe triggered,
+   * taking into account how the parameters move the homed carriages. A flat
+   * bed at Z=0 means zero height at every point, so a Levenberg-Marquardt
+   * fit finds the endstops, radius, diagonal rod and tower angles together,
+   * from a single round of probing.
+   */
+  constexpr uint8_t LSQ_RING = DELTA_CALIBRATION_LSQ_POINTS,
+                    LSQ_POINTS = 1 + LSQ_RING / 2 + LSQ_RING,
+                    LSQ_MAX_PARAMS = 7;
+
+  // Nozzle XY of each probe point: the center, then the inner and outer circles
+  static xy_pos_t lsq_point(const uint8_t i, const float dcr) {
+    if (i == 0) return xy_pos_t({ 0, 0 });
+    const bool inner = i <= LSQ_RING / 2;
+    const uint8_t n = inner ? LSQ_RING / 2 : LSQ_RING, j = inner ? i - 1 : i - 1 - LSQ_RING / 2;
+    const float a = RADIANS(210 + 360.0f * (j + (inner ? 0.5f : 0.0f)) / n), r = inner ? dcr / 2 : dcr;
+    return xy_pos_t({ cos(a) * r, sin(a) * r });
+  }
+
+  // Fitted parameters: endstops, radius, diagonal rod, then the A and B tower angles.
+  // The C tower angle and the height are left for the normalization afterward.
+  static void lsq_adjust(const uint8_t k, const float d) {
+    switch (k) {
+      case 0: case 1: case 2: delta_endstop_adj[k] += d; break;
+      case 3: delta_radius += d; break;
+      case 4: delta_diagonal_rod += d; break;
+      default: delta_tower_angle_trim[k - 5] += d; break;
+    }
+  }
+
+  static abc_float_t lsq_home() {
+    inverse_kinematics(xyz_pos_t({ 0, 0, delta_height - TERN0(HAS_BED_PROBE, probe.offset.z) }));
+    return delta;
+  }
+
+  /**
+   * Get the height of the effector at each probe trigger for the current
+   * settings, given the carriage positions, homed carriage positions and
+   * endstop adjustments recorded with the settings used for probing.
+   */
+  static float lsq_residuals(float r[], const abc_float_t carriage[], const abc_float_t &home, const abc_float_t &adj) {
+    recalc_delta_settings();
+    const abc_float_t shift = lsq_home() - home + adj - delta_endstop_adj;
+    float sum = 0;
+    for (uint8_t i = 0; i < LSQ_POINTS; ++i) {
+      forward_kinematics(carriage[i] + shift);
+      r[i] = cartes.z + TERN0(HAS_BED_PROBE, probe.offset.z);
+      sum += sq(r[i]);
+    }
+    return SQRT(sum / LSQ_POINTS);
+  }
+
+  // Solve A * x = b by Gaussian elimination with partial pivoting. A and b are overwritten.
+  static bool lsq_solve(float A[LSQ_MAX_PARAMS][LSQ_MAX_PARAMS], float b[LSQ_MAX_PARAMS], const uint8_t n) {
+    for (uint8_t c = 0; c < n; ++c) {
+      uint8_t p = c;
+      for (uint8_t i = c + 1; i < n; ++i) if (ABS(A[i][c]) > ABS(A[p][c])) p = i;
+      if (ABS(A[p][c]) < 1e-12f) return false;
+      if (p != c) {
+        for (uint8_t j = c; j < n; ++j) { const float t = A[c][j]; A[c][j] = A[p][j]; A[p][j] = t; }
+        const float t = b[c]; b[c] = b[p]; b[p] = t;
+      }
+      for (uint8_t i = c + 1; i < n; ++i) {
+        const float f = A[i][c] / A[c][c];
+        for (uint8_t j = c; j < n; ++j) A[i][j] -= f * A[c][j];
+        b[i] -= f * b[c];
+      }
+    }
+    for (int8_t i = n - 1; i >= 0; --i) {
+      for (uint8_t j = i + 1; j < n; ++j) b[i] -= A[i][j] * b[j];
+      b[i] /= A[i][i];
+    }
+    return true;
+  }
+
+  /**
+   * Fit the delta settings to the probed heights z_pt, returning the RMS
+   * height error that remains. The settings are left at the best fit.
+   */
+  static float lsq_fit(const float z_pt[LSQ_POINTS], const float dcr, const bool towers_set, const bool probe_at_offset, const int8_t verbose_level) {
+    const uint8_t np = towers_set ? 7 : 5;
+
+    // Carriage positions at each trigger, for the settings used to probe
+    const abc_float_t home = lsq_home(), adj = delta_endstop_adj;
+    abc_float_t carriage[LSQ_POINTS];
+    for (uint8_t i = 0; i < LSQ_POINTS; ++i) {
+      xy_pos_t xy = lsq_point(i, dcr);
+      #if HAS_PROBE_XY_OFFSET
+        if (probe_at_offset) xy -= probe.offset_xy;
+      #else
+        UNUSED(probe_at_offset);
+      #endif
+      inverse_kinematics(xyz_pos_t({ xy.x, xy.y, z_pt[i] - TERN0(HAS_BED_PROBE, probe.offset.z) }));
+      carriage[i] = delta;
+    }
+
+    float r[LSQ_POINTS], rk[LSQ_POINTS], J[LSQ_POINTS][LSQ_MAX_PARAMS],
+          rms = lsq_residuals(r, carriage, home, adj), lambda = 0.001f;
+
+    for (uint8_t iter = 0; iter < 20; ++iter) {
+      // Jacobian by forward differences: 0.01mm or 0.01°
+      for (uint8_t k = 0; k < np; ++k) {
+        constexpr float eps = 0.01f;
+        lsq_adjust(k, eps);
+        lsq_residuals(rk, carriage, home, adj);
+        lsq_adjust(k, -eps);
+        for (uint8_t i = 0; i < LSQ_POINTS; ++i) J[i][k] = (rk[i] - r[i]) / eps;
+      }
+
+      // Normal equations
+      float JtJ[LSQ_MAX_PARAMS][LSQ_MAX_PARAMS], Jtr[LSQ_MAX_PARAMS];
+      for (uint8_t k = 0; k < np; ++k) {
+        Jtr[k] = 0;
+        for (uint8_t i = 0; i < LSQ_POINTS; ++i) Jtr[k] -= J[i][k] * r[i];
+        for (uint8_t l = 0; l <= k; ++l) {
+          float s = 0;
+          for (uint8_t i = 0; i < LSQ_POINTS; ++i) s += J[i][k] * J[i][l];
+          JtJ[k][l] = JtJ[l][k] = s;
+        }
+      }
+
+      // Raise the damping until a step lowers the error
+      bool improved = false;
+      float step = 0;
+      while (!improved && lambda < 1e6f) {
+        float A[LSQ_MAX_PARAMS][LSQ_MAX_PARAMS], d[LSQ_MAX_PARAMS];
+        for (uint8_t k = 0; k < np; ++k) {
+          for (uint8_t l = 0; l < np; ++l) A[k][l] = JtJ[k][l];
+          A[k][k] *= 1 + lambda;
+          d[k] = Jtr[k];
+        }
+        if (lsq_solve(A, d, np)) {
+          for (uint8_t k = 0; k < np; ++k) lsq_adjust(k, d[k]);
+          const float new_rms = lsq_residuals(rk, carriage, home, adj);
+          if (new_rms < rms) {
+            improved = true;
+            rms = new_rms;
+            COPY(r, rk);
+            step = 0;
+            for (uint8_t k = 0; k < np; ++k) NOLESS(step, ABS(d[k]));
+            lambda *= 0.1f;
+          }
+          else
+            for (uint8_t k = 0; k < np; ++k) lsq_adjust(k, -d[k]);
+        }
+        if (!improved) lambda *= 10;
+      }
+
+      if (verbose_level > 1) {
+        SERIAL_ECHOPGM("Fit ", iter + 1);
+        SERIAL_ECHOLNPAIR_F(" rms:", rms, 4);
+      }
+
+      if (!improved || step < 0.0001f) break;
+    }
+
+    recalc_delta_settings();
+
+    if (verbose_level == 3) {
+      for (uint8_t i = 0; i < LSQ_POINTS; ++i) {
+        const xy_pos_t xy = lsq_point(i, dcr);
+        SERIAL_ECHOPGM(".  X", xy.x, " Y", xy.y);
+        print_signed_float(F("probed"), z_pt[i]);
+        print_signed_float(F("fitted"), r[i]);
+        SERIAL_EOL();
+      }
+    }
+
+    return rms;
+  }
+
+  /**
+   * Probe all points once, fit the settings and probe again to verify.
+   * Roll back if the verification is no better than the start.
+   */
+  static void lsq_calibration(const float dcr, const bool towers_set, const bool stow_after_each, const bool probe_at_offset, const int8_t verbose_level) {
+    const float r_old = delta_radius, h_old = delta_height, d_old = delta_diagonal_rod;
+    const abc_pos_t e_old = delta_endstop_adj, a_old = delta_tower_angle_trim;
+
+    auto probe_all = [&](float z_pt[LSQ_POINTS]) -> float {
+      float sum = 0;
+      for (uint8_t i = 0; i < LSQ_POINTS; ++i) {
+        z_pt[i] = calibration_probe(lsq_point(i, dcr), stow_after_each, probe_at_offset);
+        if (isnan(z_pt[i])) return NAN;
+        sum += sq(z_pt[i]);
+      }
+      do_blocking_move_to_xy(0.0f, 0.0f);
+      return SQRT(sum / LSQ_POINTS);
+    };
+
+    auto report = [](FSTR_P const label, const float rms) {
+      SERIAL_ECHOF(label);
+      SERIAL_ECHOLNPAIR_F(" std dev:", rms, 3);
+    };
+
+    float z_pt[LSQ_POINTS];
+    const float start_rms = probe_all(z_pt);
+    if (isnan(start_rms)) {
+      SERIAL_ECHOLNPGM("Correct delta settings with M665 and M666");
+      return;
+    }
+    report(F("Probed"), start_rms);
+
+    const float fit_rms = lsq_fit(z_pt, dcr, towers_set, probe_at_offset, verbose_level);
+    report(F("Fitted"), fit_rms);
+
+    // Normalize angles to least-squares, and height and endstops by the max amount
+    if (towers_set) {
+      const float a_mean = (delta_tower_angle_trim.a + delta_tower_angle_trim.b + delta_tower_angle_trim.c) / 3.0f;
+      LOOP_NUM_AXES(axis) delta_tower_angle_trim[axis] -= a_mean;
+    }
+    const float z_temp = _MAX(delta_endstop_adj.a, delta_endstop_adj.b, delta_endstop_adj.c);
+    delta_height -= z_temp;
+    LOOP_NUM_AXES(axis) delta_endstop_adj[axis] -= z_temp;
+
+    auto roll_back = [&]{
+      delta_endstop_adj = e_old;
+      delta_radius = r_old;
+      delta_height = h_old;
+      delta_diagonal_rod = d_old;
+      delta_tower_angle_trim = a_old;
+      recalc_delta_settings();
+    };
+
+    if (verbose_level == 0) {
+      print_calibration_settings(true, towers_set);
+      SERIAL_ECHOLNPGM(".Diag rod:", delta_diagonal_rod);
+      roll_back();
+      SERIAL_ECHOLNPGM("End DRY-RUN");
+      ac_home();  // roll_back() leaves the axes unhomed
+      return;
+    }
+
+    recalc_delta_settings();
+    ac_home();
+    const float verify_rms = probe_all(z_pt);
+    report(F("Verified"), verify_rms);
+
+    float result_rms = verify_rms;
+    if (isnan(verify_rms) || verify_rms >= start_rms) {
+      roll_back();
+      result_rms = start_rms;
+      SERIAL_ECHOLNPGM("No improvement, rolling back.");
+    }
+    else
+      SERIAL_ECHOLNPGM("Calibration OK");
+
+    char mess[21];
+    strcpy_P(mess, PSTR("Calibration sd:"));
+    if (result_rms < 1)
+      sprintf_P(&mess[15], PSTR("0.%03i"), (int)LROUND(result_rms * 1000.0f));
+    else
+      sprintf_P(&mess[15], PSTR("%03i.x"), (int)LROUND(result_rms));
+    ui.set_status(mess);
+    print_calibration_settings(true, towers_set);
+    SERIAL_ECHOLNPGM(".Diag rod:", delta_diagonal_rod);
+    SERIAL_ECHOLNPGM("Save with M500 and/or copy to Configuration.h");
+    ac_home();
+  }
+
+#endif // DELTA_CALIBRATION_LEAST_SQUARES
+
 /**
  * G33 - Delta '1-4-7-point' Auto-Calibration
  *       Calibrate height, z_offset, endstops, delta radius, and tower angles.
@@ -385,6 +653,12 @@ static float auto_tune_a(const float dcr) {
  *
  *   O   Probe at offsetted probe positions (this is wrong but it seems to work)
  *
+ * With DELTA_CALIBRATION_LEAST_SQUARES:
+ *   L   Probe DELTA_CALIBRATION_LSQ_POINTS points on an outer circle, half as many on an
+ *       inner circle, and the center, once. Fit endstops, radius, diagonal rod and (without T)
+ *       tower angles together, then probe again to verify. P, C and F are ignored.
+ *       V0 reports the fit without applying it. V2 reports each fit step. V3 reports each point.
+ *
  * With SENSORLESS_PROBING:
  *   Use these flags to calibrate stall sensitivity: (e.g., `G33 P1 Y Z` to calibrate X only.)
  *   X   Don't activate stallguard on X.
@@ -473,6 +747,17 @@ void GcodeSuite::G33() {
 
   print_calibration_settings(_endstop_results, _angle_results);
 
+  #if ENABLED(DELTA_CALIBRATION_LEAST_SQUARES)
+    if (parser.seen_test('L')) {
+      ac_setup(true);
+      ac_home();
+      lsq_calibration(dcr, towers_set, stow_after_each, probe_at_offset, verbose_level);
+      ac_cleanup(TERN_(HAS_MULTI_HOTEND, old_tool_index));
+      TERN_(FULL_REPORT_TO_HOST_FEATURE, set_and_report_grblstate(M_IDLE));
+      return;
+    }
+  #endif
+
   ac_setup(!_0p_calibration && !_1p_calibration);
 
   if (!_0p_calibration) ac_home();
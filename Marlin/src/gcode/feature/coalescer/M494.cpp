@@ -0,0 +1,56 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2023 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../../../inc/MarlinConfig.h"
+
+#if ENABLED(SEGMENT_COALESCING)
+
+#include "../../gcode.h"
+#include "../../../feature/coalescer.h"
+
+void GcodeSuite::M494_report(const bool forReplay/*=true*/) {
+  report_heading_etc(forReplay, F(STR_SEGMENT_COALESCING));
+  SERIAL_ECHOPGM("  M494 S", coalescer.enabled, " T");
+  SERIAL_ECHO_F(LINEAR_UNIT(coalescer.tolerance), 4);
+  SERIAL_EOL();
+}
+
+/**
+ * M494: Get or Set Segment Coalescing
+ *  S<bool>  Merge short collinear moves into one planner move
+ *  T<mm>    Maximum distance of a merged point from the merged line
+ *  R        Reset the merged segment count
+ *
+ * With no parameters report the settings and the number of segments merged.
+ */
+void GcodeSuite::M494() {
+  if (!parser.seen("STR")) {
+    M494_report(false);
+    SERIAL_ECHOLNPGM("Segments merged: ", coalescer.merged);
+    return;
+  }
+  if (parser.seen('S')) coalescer.enabled = parser.value_bool();
+  if (parser.seenval('T')) coalescer.tolerance = _MAX(parser.value_linear_units(), 0.001f);
+  if (parser.seen('R')) coalescer.merged = 0;
+}
+
+#endif // SEGMENT_COALESCING
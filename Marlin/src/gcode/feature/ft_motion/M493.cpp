@@ -0,0 +1,46 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2022 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../../../inc/MarlinConfig.h"
+
+#if ENABLED(FT_MOTION)
+
+#include "../../gcode.h"
+#include "../../../module/ft_motion.h"
+
+void GcodeSuite::M493_report(const bool forReplay/*=true*/) {
+  report_heading_etc(forReplay, F(STR_FT_MOTION));
+  SERIAL_ECHOLNPGM("  M493 S", ftMotion.active);
+}
+
+/**
+ * M493: Get or Set the motion engine
+ *  S<bool>  1 = Fixed-Time Motion. 0 = Trapezoid generator (default).
+ *
+ * All queued moves are completed before switching.
+ */
+void GcodeSuite::M493() {
+  if (!parser.seen('S')) return M493_report(false);
+  ftMotion.set_active(parser.value_bool());
+}
+
+#endif // FT_MOTION
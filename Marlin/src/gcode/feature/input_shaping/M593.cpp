@@ -0,0 +1,92 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2022 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../../../inc/MarlinConfig.h"
+
+#if HAS_SHAPING
+
+#include "../../gcode.h"
+#include "../../../module/stepper.h"
+
+void GcodeSuite::M593_report(const bool forReplay/*=true*/) {
+  report_heading(forReplay, F(STR_INPUT_SHAPING));
+  #define _M593_REPORT(A) do{ \
+    report_echo_start(forReplay); \
+    SERIAL_ECHOLNPGM("  M593 " STRINGIFY(A) " F", stepper.get_shaping_frequency(_AXIS(A)), \
+      " D", stepper.get_shaping_damping_ratio(_AXIS(A)), " T", int(stepper.get_shaping_type(_AXIS(A)))); \
+  }while(0)
+  TERN_(INPUT_SHAPING_X, _M593_REPORT(X));
+  TERN_(INPUT_SHAPING_Y, _M593_REPORT(Y));
+}
+
+/**
+ * M593: Get or Set Input Shaping Parameters
+ *  D<factor>    Set the zeta/damping factor. If axes (X, Y, etc.) are not specified, set for all axes.
+ *  F<frequency> Set the frequency. If axes (X, Y, etc.) are not specified, set for all axes.
+ *               0 disables shaping for the axis.
+ *  T<type>      Set the shaper type: 0=ZV 1=ZVD 2=MZV 3=EI
+ *  X<1>         Set the given parameters only for the X axis.
+ *  Y<1>         Set the given parameters only for the Y axis.
+ */
+void GcodeSuite::M593() {
+  if (!parser.seen_any()) return M593_report();
+
+  const bool seen_X = TERN0(INPUT_SHAPING_X, parser.seen_test('X')),
+             seen_Y = TERN0(INPUT_SHAPING_Y, parser.seen_test('Y')),
+             for_X = seen_X || TERN0(INPUT_SHAPING_X, !seen_Y),
+             for_Y = seen_Y || TERN0(INPUT_SHAPING_Y, !seen_X);
+
+  // Parameters can only change with no motion in progress
+  planner.synchronize();
+
+  if (parser.seen('D')) {
+    const float zeta = parser.value_float();
+    if (WITHIN(zeta, 0, 0.99f)) {
+      if (for_X) stepper.set_shaping_damping_ratio(X_AXIS, zeta);
+      if (for_Y) stepper.set_shaping_damping_ratio(Y_AXIS, zeta);
+    }
+    else
+      SERIAL_ECHO_MSG("?Zeta (D) value out of range (0-0.99)");
+  }
+
+  if (parser.seen('F')) {
+    const float freq = parser.value_float();
+    if (freq == 0 || freq >= shaping_min_freq) {
+      if (for_X) stepper.set_shaping_frequency(X_AXIS, freq);
+      if (for_Y) stepper.set_shaping_frequency(Y_AXIS, freq);
+    }
+    else
+      SERIAL_ECHOLNPGM("?Frequency (F) must be 0 or at least ", shaping_min_freq, " Hz (SHAPING_MIN_FREQ)");
+  }
+
+  if (parser.seen('T')) {
+    const uint8_t type = parser.value_byte();
+    if (type <= SHAPER_EI) {
+      if (for_X) stepper.set_shaping_type(X_AXIS, ShaperType(type));
+      if (for_Y) stepper.set_shaping_type(Y_AXIS, ShaperType(type));
+    }
+    else
+      SERIAL_ECHO_MSG("?Type (T) value out of range (0-3)");
+  }
+}
+
+#endif
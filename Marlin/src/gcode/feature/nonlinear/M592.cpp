@@ -0,0 +1,62 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2023 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../../../inc/MarlinConfig.h"
+
+#if ENABLED(NONLINEAR_EXTRUSION)
+
+#include "../../gcode.h"
+#include "../../../module/planner.h"
+
+void GcodeSuite::M592_report(const bool forReplay/*=true*/) {
+  report_heading(forReplay, F(STR_NONLINEAR_EXTRUSION));
+  EXTRUDER_LOOP() {
+    report_echo_start(forReplay);
+    SERIAL_ECHOPGM("  M592 T", e, " A");
+    SERIAL_ECHO_F(planner.nonlinear_extrusion[e].A, 5);
+    SERIAL_ECHOPGM(" B");
+    SERIAL_ECHO_F(planner.nonlinear_extrusion[e].B, 6);
+    SERIAL_EOL();
+  }
+}
+
+/**
+ * M592: Get or Set Nonlinear Extrusion Parameters
+ *  T<tool>     Which tool to address
+ *  A<factor>   Linear coefficient, per mm^3/s of flow
+ *  B<factor>   Quadratic coefficient, per (mm^3/s)^2 of flow
+ *
+ * Extruding moves are scaled by (1 + A * flow + B * flow^2),
+ * limited to the range 1/NONLINEAR_EXTRUSION_MAX to NONLINEAR_EXTRUSION_MAX.
+ */
+void GcodeSuite::M592() {
+  if (!parser.seen("AB")) return M592_report(false);
+
+  const int8_t target_extruder = get_target_extruder_from_command();
+  if (target_extruder < 0) return;
+
+  nonlinear_extrusion_t &ne = planner.nonlinear_extrusion[target_extruder];
+  if (parser.seenval('A')) ne.A = parser.value_float();
+  if (parser.seenval('B')) ne.B = parser.value_float();
+}
+
+#endif // NONLINEAR_EXTRUSION
@@ -69,6 +69,10 @@ GcodeSuite gcode;
   #include "../feature/fancheck.h"
 #endif
 
+#if ENABLED(SEGMENT_COALESCING)
+  #include "../feature/coalescer.h"
+#endif
+
 #include "../MarlinCore.h" // for idle, kill
 
 #if ENABLED(DWIN_CREALITY_LCD_JYERSUI)
@@ -351,6 +355,11 @@ void GcodeSuite::process_parsed_command(const bool no_ok/*=false*/) {
     }
   #endif
 
+  // Send merged moves to the planner ahead of anything but G0/G1
+  #if ENABLED(SEGMENT_COALESCING)
+    if (!(parser.command_letter == 'G' && parser.codenum <= 1)) coalescer.flush();
+  #endif
+
   // Handle a known command or reply "unknown command"
 
   switch (parser.command_letter) {
@@ -456,6 +465,12 @@ void GcodeSuite::process_parsed_command(const bool no_ok/*=false*/) {
       #if SAVED_POSITIONS
         case 60: G60(); break;                                    // G60:  save current position
         case 61: G61(); break;                                    // G61:  Apply/restore saved coordinates.
+      #elif ENABLED(PATH_BLENDING)
+        case 61: G61(); break;                                    // G61:  Exact path mode
+      #endif
+
+      #if ENABLED(PATH_BLENDING)
+        case 64: G64(); break;                                    // G64:  Path blending mode
       #endif
 
       #if BOTH(PTC_PROBE, PTC_BED)
@@ -893,6 +908,18 @@ void GcodeSuite::process_parsed_command(const bool no_ok/*=false*/) {
         case 486: M486(); break;                                  // M486: Identify and cancel objects
       #endif
 
+      #if ENABLED(FT_MOTION)
+        case 493: M493(); break;                                  // M493: Select the motion engine
+      #endif
+
+      #if ENABLED(SEGMENT_COALESCING)
+        case 494: M494(); break;                                  // M494: Segment coalescing
+      #endif
+
+      #if ENABLED(PLANNER_KERNEL_STATS)
+        case 495: M495(); break;                                  // M495: Report planner workload
+      #endif
+
       case 500: M500(); break;                                    // M500: Store settings in EEPROM
       case 501: M501(); break;                                    // M501: Read settings from EEPROM
       case 502: M502(); break;                                    // M502: Revert to default settings
@@ -927,10 +954,22 @@ void GcodeSuite::process_parsed_command(const bool no_ok/*=false*/) {
         case 554: M554(); break;                                  // M554: Set netmask
       #endif
 
+      #if ENABLED(ADAPTIVE_MESH)
+        case 555: M555(); break;                                  // M555: Set the print area for G29
+      #endif
+
       #if ENABLED(BAUD_RATE_GCODE)
         case 575: M575(); break;                                  // M575: Set serial baudrate
       #endif
 
+      #if ENABLED(NONLINEAR_EXTRUSION)
+        case 592: M592(); break;                                  // M592: Set nonlinear extrusion parameters
+      #endif
+
+      #if HAS_SHAPING
+        case 593: M593(); break;                                  // M593: Set input shaping parameters
+      #endif
+
       #if ENABLED(ADVANCED_PAUSE_FEATURE)
         case 600: M600(); break;                                  // M600: Pause for Filament Change
         case 603: M603(); break;                                  // M603: Configure Filament Change
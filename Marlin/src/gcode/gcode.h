@@ -66,6 +66,8 @@
  * G42  - Coordinated move to a mesh point (Requires MESH_BED_LEVELING, AUTO_BED_LEVELING_BLINEAR, or AUTO_BED_LEVELING_UBL)
  * G60  - Save current position. (Requires SAVED_POSITIONS)
  * G61  - Apply/restore saved coordinates. (Requires SAVED_POSITIONS)
+ *        Exact path mode. (Requires PATH_BLENDING without SAVED_POSITIONS)
+ * G64  - Path blending mode: P<tolerance> (Requires PATH_BLENDING)
  * G76  - Calibrate first layer temperature offsets. (Requires PTC_PROBE and PTC_BED)
  * G80  - Cancel current motion mode (Requires GCODE_MOTION_MODES)
  * G90  - Use Absolute Coordinates
@@ -244,6 +246,9 @@
  * M428 - Set the home_offset based on the current_position. Nearest edge applies. (Disabled by NO_WORKSPACE_OFFSETS or DELTA)
  * M430 - Read the system current, voltage, and power (Requires POWER_MONITOR_CURRENT, POWER_MONITOR_VOLTAGE, or POWER_MONITOR_FIXED_VOLTAGE)
  * M486 - Identify and cancel objects. (Requires CANCEL_OBJECTS)
+ * M493 - Get or set the motion engine: "M493 S<1|0>". (Requires FT_MOTION)
+ * M494 - Get or set segment coalescing: "M494 S<1|0> T<tolerance> R". (Requires SEGMENT_COALESCING)
+ * M495 - Report planner pass and trapezoid calculations per block: "M495 R". (Requires PLANNER_KERNEL_STATS)
  * M500 - Store parameters in EEPROM. (Requires EEPROM_SETTINGS)
  * M501 - Restore parameters from EEPROM. (Requires EEPROM_SETTINGS)
  * M502 - Revert to the default "factory settings". ** Does not write them to EEPROM! **
@@ -257,8 +262,11 @@
  * M552 - Get or set IP address. Enable/disable network interface. (Requires enabled Ethernet port)
  * M553 - Get or set IP netmask. (Requires enabled Ethernet port)
  * M554 - Get or set IP gateway. (Requires enabled Ethernet port)
+ * M555 - Set the print area for the next G29: "M555 X<left> Y<front> W<width> H<depth>". (Requires ADAPTIVE_MESH)
  * M569 - Enable stealthChop on an axis. (Requires at least one _DRIVER_TYPE to be TMC2130/2160/2208/2209/5130/5160)
  * M575 - Change the serial baud rate. (Requires BAUD_RATE_GCODE)
+ * M592 - Get or set nonlinear extrusion: "M592 T<tool> A<linear> B<quadratic>". (Requires NONLINEAR_EXTRUSION)
+ * M593 - Get or set input shaping parameters: "M593 [X] [Y] F<frequency> D<zeta> T<type>". (Requires INPUT_SHAPING_[XY])
  * M600 - Pause for filament change: "M600 X<pos> Y<pos> Z<raise> E<first_retract> L<later_retract>". (Requires ADVANCED_PAUSE_FEATURE)
  * M603 - Configure filament change: "M603 T<tool> U<unload_length> L<load_length>". (Requires ADVANCED_PAUSE_FEATURE)
  * M605 - Set Dual X-Carriage movement mode: "M605 S<mode> [X<x_offset>] [R<temp_offset>]". (Requires DUAL_X_CARRIAGE)
@@ -588,6 +596,12 @@ private:
   #if SAVED_POSITIONS
     static void G60();
     static void G61();
+  #elif ENABLED(PATH_BLENDING)
+    static void G61();
+  #endif
+
+  #if ENABLED(PATH_BLENDING)
+    static void G64();
   #endif
 
   #if ENABLED(GCODE_MOTION_MODES)
@@ -1034,6 +1048,20 @@ private:
     static void M486();
   #endif
 
+  #if ENABLED(FT_MOTION)
+    static void M493();
+    static void M493_report(const bool forReplay=true);
+  #endif
+
+  #if ENABLED(SEGMENT_COALESCING)
+    static void M494();
+    static void M494_report(const bool forReplay=true);
+  #endif
+
+  #if ENABLED(PLANNER_KERNEL_STATS)
+    static void M495();
+  #endif
+
   static void M500();
   static void M501();
   static void M502();
@@ -1071,6 +1099,10 @@ private:
     static void M554_report();
   #endif
 
+  #if ENABLED(ADAPTIVE_MESH)
+    static void M555();
+  #endif
+
   #if HAS_STEALTHCHOP
     static void M569();
     static void M569_report(const bool forReplay=true);
@@ -1080,6 +1112,16 @@ private:
     static void M575();
   #endif
 
+  #if ENABLED(NONLINEAR_EXTRUSION)
+    static void M592();
+    static void M592_report(const bool forReplay=true);
+  #endif
+
+  #if HAS_SHAPING
+    static void M593();
+    static void M593_report(const bool forReplay=true);
+  #endif
+
   #if ENABLED(ADVANCED_PAUSE_FEATURE)
     static void M600();
     static void M603();
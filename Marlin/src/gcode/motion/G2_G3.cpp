@@ -29,6 +29,10 @@
 #include "../../module/planner.h"
 #include "../../module/temperature.h"
 
+#if ENABLED(NATIVE_ARCS)
+  #include "../../module/ft_motion.h"
+#endif
+
 #if ENABLED(DELTA)
   #include "../../module/delta.h"
 #elif ENABLED(SCARA)
@@ -54,6 +58,8 @@
 /**
  * Plan an arc in 2 dimensions, with linear motion in the other axes.
  * The arc is traced with many small linear segments according to the configuration.
+ * With NATIVE_ARCS and Fixed-Time Motion active the arc is sent to the planner whole
+ * and Fixed-Time Motion traces the curve itself.
  */
 void plan_arc(
   const xyze_pos_t &cart,   // Destination position
@@ -197,6 +203,71 @@ void plan_arc(
   // Feedrate for the move, scaled by the feedrate multiplier
   const feedRate_t scaled_fr_mm_s = MMS_SCALED(feedrate_mm_s);
 
+  #if ENABLED(NATIVE_ARCS)
+    /**
+     * Send the whole arc to the planner as one block. Fixed-Time Motion puts the
+     * plane axes on the curve as it samples the block, so there are no chords and
+     * the planner only has to join one block per arc.
+     *
+     * Fall back to segments if the arc would be leveled or if the circle strays
+     * outside the motion limits, which can only be applied to points.
+     */
+    if (ftMotion.active && TERN1(HAS_LEVELING, !planner.leveling_active)) {
+      xyze_pos_t raw = cart;
+      #if ENABLED(AUTO_BED_LEVELING_UBL)
+        ARC_LIJKUVW_CODE(
+          raw[axis_l] = start_L,
+          raw.i = start_I, raw.j = start_J, raw.k = start_K,
+          raw.u = start_U, raw.v = start_V, raw.w = start_W
+        );
+      #endif
+      xyz_pos_t lo = current_position, hi = current_position;
+      lo[axis_p] = center_P - radius; lo[axis_q] = center_Q - radius;
+      hi[axis_p] = center_P + radius; hi[axis_q] = center_Q + radius;
+      const xyz_pos_t lo_in = lo, hi_in = hi, raw_in = raw;
+      apply_motion_limits(lo); apply_motion_limits(hi); apply_motion_limits(raw);
+      if (lo == lo_in && hi == hi_in && raw == raw_in) {
+        block_arc_t arc = { axis_p, axis_q, radius, ATAN2(rvec.b, rvec.a), 0 };
+        const xyze_pos_t start = current_position, end = raw;
+        const float travel_mm = HYPOT(flat_mm, TERN0(HAS_Z_AXIS, end[axis_l] - start[axis_l]));
+
+        // Keep the step count of each piece in range for the block
+        #if ENABLED(COMPACT_PLANNER_BLOCKS)
+          const float max_spm = _MAX(planner.settings.axis_steps_per_mm[axis_p], planner.settings.axis_steps_per_mm[axis_q]);
+          float most_steps = flat_mm * max_spm;
+          #if HAS_Z_AXIS
+            NOLESS(most_steps, ABS(end[axis_l] - start[axis_l]) * planner.settings.axis_steps_per_mm[axis_l]);
+          #endif
+          #if HAS_EXTRUDERS
+            NOLESS(most_steps, ABS(end.e - start.e) * planner.settings.axis_steps_per_mm[E_AXIS_N(active_extruder)] * planner.max_e_factor(active_extruder));
+          #endif
+          const uint16_t pieces = CEIL(most_steps / (BLOCK_SPLIT_STEPS - 1)) ?: 1;
+        #else
+          constexpr uint16_t pieces = 1;
+        #endif
+
+        PlannerHints hints;
+        hints.millimeters = travel_mm / pieces;
+        hints.arc = &arc;
+        arc.angular_travel = angular_travel / pieces;
+        for (uint16_t n = 1; n <= pieces; n++) {
+          if (n < pieces) {
+            const float f = float(n) / pieces, a = arc.start_angle + arc.angular_travel;
+            raw = start + (end - start) * f;
+            raw[axis_p] = center_P + radius * cosf(a);
+            raw[axis_q] = center_Q + radius * sinf(a);
+          }
+          else
+            raw = end;
+          if (!planner.buffer_line(raw, scaled_fr_mm_s, active_extruder, hints)) break;
+          arc.start_angle += arc.angular_travel;
+        }
+        current_position = end;
+        return;
+      }
+    }
+  #endif
+
   // Get the ideal segment length for the move based on settings
   const float ideal_segment_mm = (
     #if ARC_SEGMENTS_PER_SEC  // Length based on segments per second and feedrate
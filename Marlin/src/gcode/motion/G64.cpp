@@ -0,0 +1,52 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2023 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../../inc/MarlinConfigPre.h"
+
+#if ENABLED(PATH_BLENDING)
+
+#include "../gcode.h"
+#include "../../module/planner.h"
+
+/**
+ * G64: Blend corners between lines to hold speed through them
+ *
+ *  P<mm> - Maximum deviation from the programmed corner. (Default PATH_BLENDING_TOLERANCE)
+ *          Use P0 to follow the exact path.
+ */
+void GcodeSuite::G64() {
+  const float tol = parser.floatval('P', PATH_BLENDING_TOLERANCE);
+  planner.blend_tolerance = _MAX(tol, 0.0f);
+}
+
+#if !SAVED_POSITIONS
+
+  /**
+   * G61: Follow the exact path, stopping at corners as needed. (Same as G64 P0)
+   *
+   * With SAVED_POSITIONS G61 restores a saved position instead.
+   */
+  void GcodeSuite::G61() { planner.blend_tolerance = 0; }
+
+#endif
+
+#endif // PATH_BLENDING
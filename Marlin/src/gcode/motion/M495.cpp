@@ -0,0 +1,55 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2023 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../../inc/MarlinConfig.h"
+
+#if ENABLED(PLANNER_KERNEL_STATS)
+
+#include "../gcode.h"
+#include "../../module/planner.h"
+
+/**
+ * M495: Report the planner workload
+ *  R  Reset the counts
+ *
+ * Report the blocks queued, the pass kernels run, the blocks scanned
+ * for trapezoid changes, and the trapezoids calculated for them, in
+ * total and per block.
+ */
+void GcodeSuite::M495() {
+  Planner::kernel_stats_t &ks = planner.kernel_stats;
+  if (parser.seen('R')) { ks = { 0 }; return; }
+
+  const float per_block = ks.blocks ? 1.0f / ks.blocks : 0.0f;
+  SERIAL_ECHOLNPGM("Planner blocks:", ks.blocks, " reverse:", ks.reverse, " forward:", ks.forward, " scanned:", ks.scanned, " trapezoid:", ks.trapezoid);
+  SERIAL_ECHOPGM("Per block reverse:");
+  SERIAL_ECHO_F(ks.reverse * per_block, 2);
+  SERIAL_ECHOPGM(" forward:");
+  SERIAL_ECHO_F(ks.forward * per_block, 2);
+  SERIAL_ECHOPGM(" scanned:");
+  SERIAL_ECHO_F(ks.scanned * per_block, 2);
+  SERIAL_ECHOPGM(" trapezoid:");
+  SERIAL_ECHO_F(ks.trapezoid * per_block, 2);
+  SERIAL_EOL();
+}
+
+#endif // PLANNER_KERNEL_STATS
@@ -31,6 +31,10 @@
 #include "../../module/planner.h"
 #include "../../module/probe.h"
 
+#if ENABLED(FT_MOTION)
+  #include "../../module/ft_motion.h"
+#endif
+
 inline void G38_single_probe(const uint8_t move_value) {
   endstops.enable(true);
   G38_move = move_value;
@@ -105,6 +109,9 @@ inline bool G38_run_probe() {
  *  G38.5 - Probe away from workpiece, stop on contact break
  */
 void GcodeSuite::G38(const int8_t subcode) {
+  // Endstops are only checked by the trapezoid generator
+  TERN_(FT_MOTION, FTMotionDisableInScope FT_Disabler);
+
   // Get X Y Z E F
   get_destination_from_command();
 
@@ -594,6 +594,9 @@ void GCodeQueue::get_serial_commands() {
       else
         process_stream_char(sd_char, sd_input_state, command.buffer, sd_count);
     }
+
+    // With the queue full, read ahead while the queued commands run
+    TERN_(SD_READ_AHEAD, card.read_ahead());
   }
 
 #endif // SDSUPPORT
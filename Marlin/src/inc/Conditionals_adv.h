@@ -83,6 +83,11 @@
   #undef PROBE_DEPLOY_STOW_MENU
 #endif
 
+// The mesh is already held in the OPTIMIZED_MESH_STORAGE form
+#if ENABLED(COMPACT_MESH_Z)
+  #undef OPTIMIZED_MESH_STORAGE
+#endif
+
 #if !HAS_EXTRUDERS
   #define NO_VOLUMETRICS
   #undef TEMP_SENSOR_0
@@ -1067,3 +1072,7 @@
 #if ANY(DISABLE_INACTIVE_X, DISABLE_INACTIVE_Y, DISABLE_INACTIVE_Z, DISABLE_INACTIVE_I, DISABLE_INACTIVE_J, DISABLE_INACTIVE_K, DISABLE_INACTIVE_U, DISABLE_INACTIVE_V, DISABLE_INACTIVE_W, DISABLE_INACTIVE_E)
   #define HAS_DISABLE_INACTIVE_AXIS 1
 #endif
+
+#if EITHER(INPUT_SHAPING_X, INPUT_SHAPING_Y)
+  #define HAS_SHAPING 1
+#endif
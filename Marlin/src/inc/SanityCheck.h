@@ -945,6 +945,21 @@ static_assert(COUNT(arm) == LOGICAL_AXES, "AXIS_RELATIVE_MODES must contain " _L
 #endif
 #undef SD_CONNECTION_TYPICAL
 
+#if ENABLED(SD_READ_AHEAD)
+  #if DISABLED(SDSUPPORT)
+    #error "SD_READ_AHEAD requires SDSUPPORT."
+  #endif
+  static_assert(WITHIN(SD_READ_AHEAD_BLOCKS, 1, 8) && !((SD_READ_AHEAD_BLOCKS) & ((SD_READ_AHEAD_BLOCKS) - 1)), "SD_READ_AHEAD_BLOCKS must be 1, 2, 4, or 8.");
+#endif
+
+#if ENABLED(SD_BLOCK_CACHE)
+  #if DISABLED(SDSUPPORT)
+    #error "SD_BLOCK_CACHE requires SDSUPPORT."
+  #endif
+  static_assert(WITHIN(SD_CACHE_FAT_BLOCKS, 1, 16), "SD_CACHE_FAT_BLOCKS must be from 1 to 16.");
+  static_assert(WITHIN(SD_CACHE_DATA_BLOCKS, 1, 16), "SD_CACHE_DATA_BLOCKS must be from 1 to 16.");
+#endif
+
 /**
  * SD File Sorting
  */
@@ -1339,6 +1354,84 @@ static_assert(COUNT(arm) == LOGICAL_AXES, "AXIS_RELATIVE_MODES must contain " _L
   #endif
 #endif
 
+/**
+ * Input Shaping requirements
+ */
+#if HAS_SHAPING
+  #if IS_KINEMATIC
+    #error "Input Shaping is not compatible with kinematic machines (DELTA, SCARA, etc.)."
+  #elif ENABLED(DIRECT_STEPPING)
+    #error "Input Shaping is not compatible with DIRECT_STEPPING."
+  #elif ENABLED(I2S_STEPPER_STREAM)
+    #error "Input Shaping is not compatible with I2S_STEPPER_STREAM."
+  #endif
+  #if ENABLED(INPUT_SHAPING_X)
+    static_assert(SHAPING_FREQ_X >= 0, "SHAPING_FREQ_X must be >= 0.");
+    static_assert(WITHIN(SHAPING_ZETA_X, 0, 0.99f), "SHAPING_ZETA_X must be from 0 to 0.99.");
+  #endif
+  #if ENABLED(INPUT_SHAPING_Y)
+    static_assert(SHAPING_FREQ_Y >= 0, "SHAPING_FREQ_Y must be >= 0.");
+    static_assert(WITHIN(SHAPING_ZETA_Y, 0, 0.99f), "SHAPING_ZETA_Y must be from 0 to 0.99.");
+  #endif
+#endif
+
+/**
+ * Fixed-Time Motion requirements
+ */
+#if ENABLED(FT_MOTION)
+  #ifdef __AVR__
+    #error "FT_MOTION requires a 32-bit processor."
+  #elif HAS_MULTI_EXTRUDER || ENABLED(MIXING_EXTRUDER)
+    #error "FT_MOTION is limited to a single extruder."
+  #elif EITHER(DIRECT_STEPPING, I2S_STEPPER_STREAM)
+    #error "FT_MOTION is not compatible with DIRECT_STEPPING or I2S_STEPPER_STREAM."
+  #elif HAS_CUTTER
+    #error "FT_MOTION is not compatible with a laser or spindle."
+  #elif ENABLED(FTM_PRESSURE_ADVANCE) && DISABLED(LIN_ADVANCE)
+    #error "FTM_PRESSURE_ADVANCE requires LIN_ADVANCE."
+  #endif
+  #if ENABLED(FTM_PRESSURE_ADVANCE)
+    static_assert((FTM_PA_SMOOTH_TIME) * (FTM_FS) >= 2, "FTM_PA_SMOOTH_TIME must span at least two samples.");
+  #endif
+  static_assert((FTM_STEPPER_FS) % (FTM_FS) == 0, "FTM_STEPPER_FS must be a multiple of FTM_FS.");
+  static_assert(WITHIN(FTM_BUFFER_SIZE, 2 * (FTM_STEPPER_FS) / (FTM_FS), 32767), "FTM_BUFFER_SIZE must hold at least two samples and at most 32767 commands.");
+#endif
+
+/**
+ * Native Arcs requirements
+ */
+#if ENABLED(NATIVE_ARCS)
+  #if DISABLED(FT_MOTION)
+    #error "NATIVE_ARCS requires FT_MOTION."
+  #elif !HAS_JUNCTION_DEVIATION
+    #error "NATIVE_ARCS requires Junction Deviation (CLASSIC_JERK disabled)."
+  #elif ANY(IS_KINEMATIC, IS_CORE, MARKFORGED_XY, MARKFORGED_YX)
+    #error "NATIVE_ARCS requires a Cartesian machine."
+  #elif ENABLED(BACKLASH_COMPENSATION)
+    #error "NATIVE_ARCS is not compatible with BACKLASH_COMPENSATION."
+  #elif ENABLED(SKEW_CORRECTION)
+    #error "NATIVE_ARCS is not compatible with SKEW_CORRECTION."
+  #endif
+#endif
+
+/**
+ * Step Event Queue requirements
+ */
+#if ENABLED(STEP_EVENT_QUEUE)
+  #ifdef __AVR__
+    #error "STEP_EVENT_QUEUE requires a 32-bit processor."
+  #elif ENABLED(FT_MOTION)
+    #error "STEP_EVENT_QUEUE is not compatible with FT_MOTION."
+  #elif HAS_MULTI_EXTRUDER || ENABLED(MIXING_EXTRUDER)
+    #error "STEP_EVENT_QUEUE is limited to a single extruder."
+  #elif ANY(LIN_ADVANCE, INPUT_SHAPING_X, INPUT_SHAPING_Y, INTEGRATED_BABYSTEPPING)
+    #error "STEP_EVENT_QUEUE is not compatible with LIN_ADVANCE, INPUT_SHAPING_[XY], or INTEGRATED_BABYSTEPPING."
+  #elif ANY(DIRECT_STEPPING, I2S_STEPPER_STREAM, LASER_FEATURE)
+    #error "STEP_EVENT_QUEUE is not compatible with DIRECT_STEPPING, I2S_STEPPER_STREAM, or LASER_FEATURE."
+  #endif
+  static_assert(WITHIN(STEP_EVENT_QUEUE_SIZE, 256, 32768) && !((STEP_EVENT_QUEUE_SIZE) & ((STEP_EVENT_QUEUE_SIZE) - 1)), "STEP_EVENT_QUEUE_SIZE must be a power of 2 from 256 to 32768.");
+#endif
+
 /**
  * Special tool-changing options
  */
@@ -1639,6 +1732,36 @@ static_assert(COUNT(arm) == LOGICAL_AXES, "AXIS_RELATIVE_MODES must contain " _L
   #endif
 #endif
 
+/**
+ * Curvature-adaptive kinematic segments
+ */
+#ifdef DELTA_SEGMENT_DEVIATION
+  #if DISABLED(DELTA)
+    #error "DELTA_SEGMENT_DEVIATION requires DELTA."
+  #endif
+  static_assert(DELTA_SEGMENT_DEVIATION > 0, "DELTA_SEGMENT_DEVIATION must be greater than 0.");
+#endif
+#if ENABLED(DELTA_CACHED_FK) && DISABLED(DELTA)
+  #error "DELTA_CACHED_FK requires DELTA."
+#endif
+#if ENABLED(DELTA_CALIBRATION_LEAST_SQUARES)
+  #if DISABLED(DELTA_AUTO_CALIBRATION)
+    #error "DELTA_CALIBRATION_LEAST_SQUARES requires DELTA_AUTO_CALIBRATION."
+  #elif !WITHIN(DELTA_CALIBRATION_LSQ_POINTS, 6, 24)
+    #error "DELTA_CALIBRATION_LSQ_POINTS must be from 6 to 24."
+  #endif
+#endif
+#ifdef SCARA_SEGMENT_DEVIATION
+  #if !IS_SCARA
+    #error "SCARA_SEGMENT_DEVIATION requires MORGAN_SCARA, MP_SCARA, or AXEL_TPARA."
+  #endif
+  static_assert(SCARA_SEGMENT_DEVIATION > 0, "SCARA_SEGMENT_DEVIATION must be greater than 0.");
+#endif
+
+#if ENABLED(SCARA_FAST_TRIG) && !IS_SCARA
+  #error "SCARA_FAST_TRIG requires MORGAN_SCARA, MP_SCARA, or AXEL_TPARA."
+#endif
+
 /**
  * Junction deviation is incompatible with kinematic systems.
  */
@@ -1646,6 +1769,51 @@ static_assert(COUNT(arm) == LOGICAL_AXES, "AXIS_RELATIVE_MODES must contain " _L
   #error "CLASSIC_JERK is required for DELTA and SCARA."
 #endif
 
+/**
+ * Jerk-limited S-Curve requirements
+ */
+#if ENABLED(S_CURVE_JERK_LIMIT)
+  #if DISABLED(S_CURVE_ACCELERATION)
+    #error "S_CURVE_JERK_LIMIT requires S_CURVE_ACCELERATION."
+  #elif !defined(S_CURVE_MAX_JERK)
+    #error "S_CURVE_JERK_LIMIT requires S_CURVE_MAX_JERK."
+  #endif
+  static_assert(S_CURVE_MAX_JERK > 0, "S_CURVE_MAX_JERK must be greater than 0.");
+#endif
+
+/**
+ * G5 Bézier segment size
+ */
+#if ENABLED(BEZIER_CURVE_SUPPORT) && defined(BEZIER_MAX_DEVIATION)
+  static_assert(BEZIER_MAX_DEVIATION > 0, "BEZIER_MAX_DEVIATION must be greater than 0.");
+#endif
+
+/**
+ * Path Blending requirements
+ */
+#if ENABLED(PATH_BLENDING)
+  #if !HAS_JUNCTION_DEVIATION
+    #error "PATH_BLENDING requires Junction Deviation (i.e., disable CLASSIC_JERK)."
+  #endif
+  static_assert(PATH_BLENDING_TOLERANCE >= 0, "PATH_BLENDING_TOLERANCE must be 0 or greater.");
+#endif
+
+/**
+ * Segment Coalescing requirements
+ */
+#if ENABLED(SEGMENT_COALESCING)
+  #if IS_KINEMATIC
+    #error "SEGMENT_COALESCING is not compatible with DELTA, SCARA, or other kinematic machines."
+  #elif ENABLED(LASER_FEATURE)
+    #error "SEGMENT_COALESCING is not compatible with LASER_FEATURE."
+  #elif !WITHIN(COALESCE_MAX_SEGMENTS, 2, 64)
+    #error "COALESCE_MAX_SEGMENTS must be from 2 to 64."
+  #endif
+  static_assert(COALESCE_TOLERANCE > 0, "COALESCE_TOLERANCE must be greater than 0.");
+  static_assert(COALESCE_E_RATIO >= 0, "COALESCE_E_RATIO must be 0 or greater.");
+  static_assert(COALESCE_MAX_SEGMENT_MM > 0, "COALESCE_MAX_SEGMENT_MM must be greater than 0.");
+#endif
+
 /**
  * Some things should not be used on Belt Printers
  */
@@ -1666,6 +1834,16 @@ static_assert(COUNT(arm) == LOGICAL_AXES, "AXIS_RELATIVE_MODES must contain " _L
   #error "Please enable only one probe option: PROBE_MANUALLY, SENSORLESS_PROBING, BLTOUCH, BD_SENSOR, FIX_MOUNTED_PROBE, NOZZLE_AS_PROBE, TOUCH_MI_PROBE, SOLENOID_PROBE, Z_PROBE_ALLEN_KEY, Z_PROBE_SLED, MAGLEV4, MAG_MOUNTED_PROBE or Z Servo."
 #endif
 
+#if ENABLED(BD_SENSOR_FLYING_SCAN)
+  #if DISABLED(BD_SENSOR)
+    #error "BD_SENSOR_FLYING_SCAN requires BD_SENSOR."
+  #elif DISABLED(AUTO_BED_LEVELING_BILINEAR)
+    #error "BD_SENSOR_FLYING_SCAN requires AUTO_BED_LEVELING_BILINEAR."
+  #elif ENABLED(STEP_EVENT_QUEUE)
+    #error "BD_SENSOR_FLYING_SCAN is not compatible with STEP_EVENT_QUEUE."
+  #endif
+#endif
+
 #if HAS_BED_PROBE
 
   /**
@@ -1924,6 +2102,10 @@ static_assert(COUNT(arm) == LOGICAL_AXES, "AXIS_RELATIVE_MODES must contain " _L
     #error "GRID_MAX_POINTS_[XY] must be a whole number between 3 and 15."
   #endif
 
+  #if ENABLED(UBL_CELL_CACHE)
+    static_assert(WITHIN(UBL_CELL_CACHE_SIZE, 1, 64) && !((UBL_CELL_CACHE_SIZE) & ((UBL_CELL_CACHE_SIZE) - 1)), "UBL_CELL_CACHE_SIZE must be a power of 2 from 1 to 64.");
+  #endif
+
 #elif HAS_ABL_NOT_UBL
 
   /**
@@ -1937,6 +2119,26 @@ static_assert(COUNT(arm) == LOGICAL_AXES, "AXIS_RELATIVE_MODES must contain " _L
     #error "SCARA machines can only use the AUTO_BED_LEVELING_BILINEAR leveling option."
   #endif
 
+  #if ENABLED(ABL_BILINEAR_BICUBIC)
+    #if DISABLED(AUTO_BED_LEVELING_BILINEAR)
+      #error "ABL_BILINEAR_BICUBIC requires AUTO_BED_LEVELING_BILINEAR."
+    #elif ENABLED(ABL_BILINEAR_SUBDIVISION)
+      #error "ABL_BILINEAR_BICUBIC and ABL_BILINEAR_SUBDIVISION are not compatible. Enable only one."
+    #elif IS_CARTESIAN && DISABLED(SEGMENT_LEVELED_MOVES)
+      #error "ABL_BILINEAR_BICUBIC requires SEGMENT_LEVELED_MOVES."
+    #endif
+  #endif
+
+  #if ENABLED(ABL_PROBE_TOUR)
+    #if NONE(AUTO_BED_LEVELING_LINEAR, AUTO_BED_LEVELING_BILINEAR)
+      #error "ABL_PROBE_TOUR requires AUTO_BED_LEVELING_LINEAR or AUTO_BED_LEVELING_BILINEAR."
+    #elif ENABLED(PROBE_MANUALLY)
+      #error "ABL_PROBE_TOUR is not compatible with PROBE_MANUALLY."
+    #elif (GRID_MAX_POINTS) > 255
+      #error "ABL_PROBE_TOUR requires GRID_MAX_POINTS of 255 or less."
+    #endif
+  #endif
+
 #elif ENABLED(MESH_BED_LEVELING)
 
   // Mesh Bed Leveling
@@ -1952,6 +2154,25 @@ static_assert(COUNT(arm) == LOGICAL_AXES, "AXIS_RELATIVE_MODES must contain " _L
   #error "Only enable RESTORE_LEVELING_AFTER_G28 or ENABLE_LEVELING_AFTER_G28, but not both."
 #endif
 
+#if ENABLED(ADAPTIVE_MESH)
+  #if NONE(AUTO_BED_LEVELING_BILINEAR, AUTO_BED_LEVELING_UBL)
+    #error "ADAPTIVE_MESH requires AUTO_BED_LEVELING_BILINEAR or AUTO_BED_LEVELING_UBL."
+  #elif !HAS_BED_PROBE
+    #error "ADAPTIVE_MESH requires a bed probe."
+  #endif
+  static_assert(ADAPTIVE_MESH_MARGIN >= 0, "ADAPTIVE_MESH_MARGIN must be 0 or more.");
+#endif
+
+#if ENABLED(COMPACT_MESH_Z)
+  #if NONE(AUTO_BED_LEVELING_BILINEAR, AUTO_BED_LEVELING_UBL)
+    #error "COMPACT_MESH_Z requires AUTO_BED_LEVELING_BILINEAR or AUTO_BED_LEVELING_UBL."
+  #elif ENABLED(EXTENSIBLE_UI)
+    #error "COMPACT_MESH_Z is not compatible with EXTENSIBLE_UI."
+  #elif ENABLED(DWIN_LCD_PROUI)
+    #error "COMPACT_MESH_Z is not compatible with DWIN_LCD_PROUI."
+  #endif
+#endif
+
 #if HAS_MESH && HAS_CLASSIC_JERK
   static_assert(DEFAULT_ZJERK > 0.1, "Low DEFAULT_ZJERK values are incompatible with mesh-based leveling.");
 #endif
@@ -2116,6 +2337,30 @@ static_assert(COUNT(arm) == LOGICAL_AXES, "AXIS_RELATIVE_MODES must contain " _L
   #elif MIN_STEPS_PER_SEGMENT > 1
     #error "VOLUMETRIC_EXTRUDER_LIMIT is not compatible with MIN_STEPS_PER_SEGMENT greater than 1."
   #endif
+  #if ENABLED(VOLUMETRIC_LIMIT_BY_TEMP)
+    #if !HAS_HOTEND
+      #error "VOLUMETRIC_LIMIT_BY_TEMP requires a hotend."
+    #elif VOLUMETRIC_LIMIT_REF_TEMP <= VOLUMETRIC_LIMIT_MELT_TEMP
+      #error "VOLUMETRIC_LIMIT_REF_TEMP must be greater than VOLUMETRIC_LIMIT_MELT_TEMP."
+    #endif
+    static_assert(VOLUMETRIC_LIMIT_HEADROOM > 0 && VOLUMETRIC_LIMIT_HEADROOM < 1, "VOLUMETRIC_LIMIT_HEADROOM must be between 0 and 1.");
+    static_assert(VOLUMETRIC_LIMIT_MIN_SCALE > 0 && VOLUMETRIC_LIMIT_MIN_SCALE <= 1, "VOLUMETRIC_LIMIT_MIN_SCALE must be greater than 0 and no more than 1.");
+    static_assert(VOLUMETRIC_LIMIT_MAX_SCALE >= 1, "VOLUMETRIC_LIMIT_MAX_SCALE must be 1 or greater.");
+  #endif
+#elif ENABLED(VOLUMETRIC_LIMIT_BY_TEMP)
+  #error "VOLUMETRIC_LIMIT_BY_TEMP requires VOLUMETRIC_EXTRUDER_LIMIT."
+#endif
+
+/**
+ * Nonlinear Extrusion
+ */
+#if ENABLED(NONLINEAR_EXTRUSION)
+  #if !HAS_EXTRUDERS
+    #error "NONLINEAR_EXTRUSION requires at least one extruder."
+  #elif ENABLED(NO_VOLUMETRICS)
+    #error "NONLINEAR_EXTRUSION requires NO_VOLUMETRICS to be disabled."
+  #endif
+  static_assert(NONLINEAR_EXTRUSION_MAX >= 1, "NONLINEAR_EXTRUSION_MAX must be 1 or greater.");
 #endif
 
 /**
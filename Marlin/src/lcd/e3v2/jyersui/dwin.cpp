@@ -298,6 +298,7 @@ CrealityDWINClass CrealityDWIN;
 
           bedlevel.z_values[i][j] = mz - lsf_results.D;
         }
+        bedlevel.refresh_bed_level();
         return false;
       }
 
@@ -311,6 +312,9 @@ CrealityDWINClass CrealityDWIN;
 
     #endif
 
+    // Drop what leveling has cached from the mesh after changing a point
+    static void refresh_mesh() { IF_DISABLED(MESH_BED_LEVELING, bedlevel.refresh_bed_level()); }
+
     void manual_mesh_move(const bool zmove=false) {
       if (zmove) {
         planner.synchronize();
@@ -4281,7 +4285,7 @@ void CrealityDWINClass::Menu_Item_Handler(uint8_t menu, uint8_t item, bool draw/
               if (draw)
                 Draw_Menu_Item(row, ICON_Mesh, F("Zero Current Mesh"));
               else
-                ZERO(bedlevel.z_values);
+                bedlevel.set_all_mesh_points_to_value(0);
               break;
 
             case LEVELING_SETTINGS_UNDEF:
@@ -4331,7 +4335,7 @@ void CrealityDWINClass::Menu_Item_Handler(uint8_t menu, uint8_t item, bool draw/
               Draw_Menu_Item(row, ICON_Back, GET_TEXT_F(MSG_BACK));
             else {
               set_bed_leveling_enabled(level_state);
-              TERN_(AUTO_BED_LEVELING_BILINEAR, bedlevel.refresh_bed_level());
+              mesh_conf.refresh_mesh();
               Draw_Menu(Leveling, LEVELING_MANUAL);
             }
             break;
@@ -4374,7 +4378,7 @@ void CrealityDWINClass::Menu_Item_Handler(uint8_t menu, uint8_t item, bool draw/
             else {
               if (isnan(bedlevel.z_values[mesh_conf.mesh_x][mesh_conf.mesh_y]))
                 bedlevel.z_values[mesh_conf.mesh_x][mesh_conf.mesh_y] = 0;
-              Modify_Value(bedlevel.z_values[mesh_conf.mesh_x][mesh_conf.mesh_y], MIN_Z_OFFSET, MAX_Z_OFFSET, 100);
+              Modify_Value(bedlevel.z_values[mesh_conf.mesh_x][mesh_conf.mesh_y], MIN_Z_OFFSET, MAX_Z_OFFSET, 100, mesh_conf.refresh_mesh);
             }
             break;
           case LEVELING_M_UP:
@@ -4382,6 +4386,7 @@ void CrealityDWINClass::Menu_Item_Handler(uint8_t menu, uint8_t item, bool draw/
               Draw_Menu_Item(row, ICON_Axis, F("Microstep Up"));
             else if (bedlevel.z_values[mesh_conf.mesh_x][mesh_conf.mesh_y] < MAX_Z_OFFSET) {
               bedlevel.z_values[mesh_conf.mesh_x][mesh_conf.mesh_y] += 0.01;
+              mesh_conf.refresh_mesh();
               gcode.process_subcommands_now(F("M290 Z0.01"));
               planner.synchronize();
               current_position.z += 0.01f;
@@ -4394,6 +4399,7 @@ void CrealityDWINClass::Menu_Item_Handler(uint8_t menu, uint8_t item, bool draw/
               Draw_Menu_Item(row, ICON_AxisD, F("Microstep Down"));
             else if (bedlevel.z_values[mesh_conf.mesh_x][mesh_conf.mesh_y] > MIN_Z_OFFSET) {
               bedlevel.z_values[mesh_conf.mesh_x][mesh_conf.mesh_y] -= 0.01;
+              mesh_conf.refresh_mesh();
               gcode.process_subcommands_now(F("M290 Z-0.01"));
               planner.synchronize();
               current_position.z -= 0.01f;
@@ -4580,7 +4586,7 @@ void CrealityDWINClass::Menu_Item_Handler(uint8_t menu, uint8_t item, bool draw/
             else {
               if (isnan(bedlevel.z_values[mesh_conf.mesh_x][mesh_conf.mesh_y]))
                 bedlevel.z_values[mesh_conf.mesh_x][mesh_conf.mesh_y] = 0;
-              Modify_Value(bedlevel.z_values[mesh_conf.mesh_x][mesh_conf.mesh_y], MIN_Z_OFFSET, MAX_Z_OFFSET, 100);
+              Modify_Value(bedlevel.z_values[mesh_conf.mesh_x][mesh_conf.mesh_y], MIN_Z_OFFSET, MAX_Z_OFFSET, 100, mesh_conf.refresh_mesh);
             }
             break;
           case UBL_M_UP:
@@ -4588,6 +4594,7 @@ void CrealityDWINClass::Menu_Item_Handler(uint8_t menu, uint8_t item, bool draw/
               Draw_Menu_Item(row, ICON_Axis, F("Microstep Up"));
             else if (bedlevel.z_values[mesh_conf.mesh_x][mesh_conf.mesh_y] < MAX_Z_OFFSET) {
               bedlevel.z_values[mesh_conf.mesh_x][mesh_conf.mesh_y] += 0.01;
+              mesh_conf.refresh_mesh();
               gcode.process_subcommands_now(F("M290 Z0.01"));
               planner.synchronize();
               current_position.z += 0.01f;
@@ -4600,6 +4607,7 @@ void CrealityDWINClass::Menu_Item_Handler(uint8_t menu, uint8_t item, bool draw/
               Draw_Menu_Item(row, ICON_Axis, F("Microstep Down"));
             else if (bedlevel.z_values[mesh_conf.mesh_x][mesh_conf.mesh_y] > MIN_Z_OFFSET) {
               bedlevel.z_values[mesh_conf.mesh_x][mesh_conf.mesh_y] -= 0.01;
+              mesh_conf.refresh_mesh();
               gcode.process_subcommands_now(F("M290 Z-0.01"));
               planner.synchronize();
               current_position.z -= 0.01f;
@@ -5362,6 +5370,9 @@ void CrealityDWINClass::Value_Control() {
       case 3: *(int16_t*)valuepointer = tempvalue / valueunit; break;
       case 4: *(uint32_t*)valuepointer = tempvalue / valueunit; break;
       case 5: *(int8_t*)valuepointer = tempvalue / valueunit; break;
+      #if ENABLED(COMPACT_MESH_Z)
+        case 6: *(mesh_z_t*)valuepointer = tempvalue / valueunit; break;
+      #endif
     }
     switch (active_menu) {
       case Move:
@@ -6048,6 +6059,13 @@ void CrealityDWINClass::Modify_Value(int8_t &value, float min, float max, float
   funcpointer = f;
   Setup_Value((float)value, min, max, unit, 5);
 }
+#if ENABLED(COMPACT_MESH_Z)
+  void CrealityDWINClass::Modify_Value(mesh_z_t &value, float min, float max, float unit, void (*f)()/*=nullptr*/) {
+    valuepointer = &value;
+    funcpointer = f;
+    Setup_Value((float)value, min, max, unit, 6);
+  }
+#endif
 
 void CrealityDWINClass::Modify_Option(uint8_t value, const char * const * options, uint8_t max) {
   tempvalue = value;
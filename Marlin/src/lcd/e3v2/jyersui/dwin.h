@@ -34,6 +34,10 @@
 
 #include "../../../inc/MarlinConfig.h"
 
+#if ENABLED(COMPACT_MESH_Z)
+  class mesh_z_t;
+#endif
+
 enum processID : uint8_t {
   Main, Print, Menu, Value, Option, File, Popup, Confirm, Wait, Locked, Cancel, Keyboard
 };
@@ -245,6 +249,9 @@ public:
   static void Modify_Value(int16_t &value, float min, float max, float unit, void (*f)()=nullptr);
   static void Modify_Value(uint32_t &value, float min, float max, float unit, void (*f)()=nullptr);
   static void Modify_Value(int8_t &value, float min, float max, float unit, void (*f)()=nullptr);
+  #if ENABLED(COMPACT_MESH_Z)
+    static void Modify_Value(mesh_z_t &value, float min, float max, float unit, void (*f)()=nullptr);
+  #endif
   static void Modify_Option(uint8_t value, const char * const * options, uint8_t max);
 
   static void Update_Status(const char * const text);
@@ -3777,7 +3777,8 @@ void Draw_Steps_Menu() {
     void SetEditMeshX() { HMI_value.Select = 0; SetIntOnClick(0, GRID_MAX_POINTS_X - 1, BedLevelTools.mesh_x, ApplyEditMeshX, LiveEditMesh); }
     void ApplyEditMeshY() { BedLevelTools.mesh_y = MenuData.Value; }
     void SetEditMeshY() { HMI_value.Select = 1; SetIntOnClick(0, GRID_MAX_POINTS_Y - 1, BedLevelTools.mesh_y, ApplyEditMeshY, LiveEditMesh); }
-    void SetEditZValue() { SetPFloatOnClick(Z_OFFSET_MIN, Z_OFFSET_MAX, 3); }
+    void ApplyEditMeshZ() { IF_DISABLED(MESH_BED_LEVELING, bedlevel.refresh_bed_level()); }
+    void SetEditZValue() { SetPFloatOnClick(Z_OFFSET_MIN, Z_OFFSET_MAX, 3, ApplyEditMeshZ); }
   #endif
 #endif
 
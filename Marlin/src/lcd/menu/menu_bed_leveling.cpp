@@ -204,17 +204,33 @@
 #if ENABLED(MESH_EDIT_MENU)
 
   inline void refresh_planner() {
+    TERN_(UBL_CELL_CACHE, bedlevel.refresh_bed_level());
     set_current_from_steppers_for_axis(ALL_AXES_ENUM);
     sync_plan_position();
   }
 
+  static uint8_t xind, yind; // =0
+
+  #if ENABLED(COMPACT_MESH_Z)
+    // Compact mesh points can't be edited in place, so edit a float copy
+    static float edit_z;
+    inline void store_mesh_z() {
+      bedlevel.z_values[xind][yind] = edit_z;
+      refresh_planner();
+    }
+  #endif
+
   void menu_edit_mesh() {
-    static uint8_t xind, yind; // =0
     START_MENU();
     BACK_ITEM(MSG_BED_LEVELING);
     EDIT_ITEM(uint8, MSG_MESH_X, &xind, 0, (GRID_MAX_POINTS_X) - 1);
     EDIT_ITEM(uint8, MSG_MESH_Y, &yind, 0, (GRID_MAX_POINTS_Y) - 1);
-    EDIT_ITEM_FAST(float43, MSG_MESH_EDIT_Z, &bedlevel.z_values[xind][yind], -(LCD_PROBE_Z_RANGE) * 0.5, (LCD_PROBE_Z_RANGE) * 0.5, refresh_planner);
+    #if ENABLED(COMPACT_MESH_Z)
+      edit_z = bedlevel.z_values[xind][yind];
+      EDIT_ITEM_FAST(float43, MSG_MESH_EDIT_Z, &edit_z, -(LCD_PROBE_Z_RANGE) * 0.5, (LCD_PROBE_Z_RANGE) * 0.5, store_mesh_z);
+    #else
+      EDIT_ITEM_FAST(float43, MSG_MESH_EDIT_Z, &bedlevel.z_values[xind][yind], -(LCD_PROBE_Z_RANGE) * 0.5, (LCD_PROBE_Z_RANGE) * 0.5, refresh_planner);
+    #endif
     END_MENU();
   }
 
@@ -0,0 +1,65 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * fast_trig.h - Polynomial trig for inverse kinematics
+ *
+ * These replace the library functions in the SCARA and TPARA inverse
+ * kinematics (SCARA_FAST_TRIG), which run for every segment. The library
+ * functions reduce the argument and iterate for full float precision, which
+ * is slow on boards without an FPU.
+ */
+
+#include "../core/macros.h"
+
+/**
+ * atan2 by folding into the first octant and evaluating an 11th order
+ * minimax polynomial for atan on [0,1].
+ * Max error is 1.8e-6 radians (0.0001°), about 1µm at the end of a 300mm arm.
+ */
+FORCE_INLINE float fast_atan2(const float y, const float x) {
+  const float ax = ABS(x), ay = ABS(y), big = _MAX(ax, ay);
+  if (big == 0) return 0;
+  const float a = _MIN(ax, ay) / big, s = sq(a);
+  float r = a * (0.999977231f + s * (-0.332622916f + s * (0.193540901f + s * (-0.116427742f + s * (0.0526486598f + s * -0.0117196189f)))));
+  if (ay > ax) r = float(M_PI_2) - r;
+  if (x < 0) r = float(M_PI) - r;
+  return y < 0 ? -r : r;
+}
+
+/**
+ * acos from fast_atan2, with the same error bound.
+ */
+FORCE_INLINE float fast_acos(const float x) {
+  return fast_atan2(SQRT(1.0f - sq(x)), x);
+}
+
+// Trig used by the inverse kinematics, as a template parameter
+struct float_trig {
+  static float atan2(const float y, const float x) { return ATAN2(y, x); }
+  static float acos(const float x) { return ACOS(x); }
+};
+struct fast_trig {
+  static float atan2(const float y, const float x) { return fast_atan2(y, x); }
+  static float acos(const float x) { return fast_acos(x); }
+};
@@ -46,6 +46,10 @@
   #include "stepper/indirection.h"
 #endif
 
+#if BOTH(DELTA_CACHED_FK, MARLIN_TEST_BUILD)
+  #include "../tests/test_helpers.h"
+#endif
+
 #define DEBUG_OUT ENABLED(DEBUG_LEVELING_FEATURE)
 #include "../core/debug_out.h"
 
@@ -61,6 +65,21 @@ abc_float_t delta_diagonal_rod_2_tower;
 float delta_clip_start_height = Z_MAX_POS;
 abc_float_t delta_diagonal_rod_trim;
 
+#if ENABLED(DELTA_CACHED_FK)
+  /**
+   * Forward kinematics constants, set by recalc_delta_settings().
+   * The difference of two towers' rod equations is linear in the effector
+   * position, so XY is a linear function of Z, leaving a quadratic in Z.
+   */
+  static struct {
+    xy_float_t m_inv[2];  // Inverse of the 2x2 matrix 2 * (tower B - tower A, tower C - tower A)
+    abc_float_t k;        // Squared tower distance from center minus rod length squared
+    bool valid;           // 'last_abc' and 'last' hold a solution for this geometry
+    abc_float_t last_abc;
+    xyz_pos_t last;
+  } fk;
+#endif
+
 float delta_safe_distance_from_top();
 
 void refresh_delta_clip_start_height() {
@@ -85,6 +104,17 @@ void recalc_delta_settings() {
   delta_diagonal_rod_2_tower.set(sq(delta_diagonal_rod + delta_diagonal_rod_trim.a),
                                  sq(delta_diagonal_rod + delta_diagonal_rod_trim.b),
                                  sq(delta_diagonal_rod + delta_diagonal_rod_trim.c));
+
+  #if ENABLED(DELTA_CACHED_FK)
+    const xy_float_t mb = (delta_tower[B_AXIS] - delta_tower[A_AXIS]) * 2,
+                     mc = (delta_tower[C_AXIS] - delta_tower[A_AXIS]) * 2;
+    const float inv_det = RECIPROCAL(mb.x * mc.y - mb.y * mc.x);
+    fk.m_inv[0].set( mc.y * inv_det, -mb.y * inv_det);
+    fk.m_inv[1].set(-mc.x * inv_det,  mb.x * inv_det);
+    LOOP_ABC(t) fk.k[t] = HYPOT2(delta_tower[t].x, delta_tower[t].y) - delta_diagonal_rod_2_tower[t];
+    fk.valid = false;
+  #endif
+
   update_software_endstops(Z_AXIS);
   set_all_unhomed();
 }
@@ -137,6 +167,36 @@ float delta_safe_distance_from_top() {
   return ABS(centered_extent - delta.a);
 }
 
+#ifdef DELTA_SEGMENT_DEVIATION
+
+  /**
+   * Each carriage height is z + sqrt(q), with q = rod^2 - (horizontal distance
+   * to the tower)^2. Along a straight line the second derivative of the height is
+   *   -(|u.xy|^2 * q + (d.u)^2) / q^(3/2)
+   * where d is the offset from the tower. The numerator equals |u.xy|^2 times
+   * (rod^2 - (distance from the tower to the line)^2), which is the same all
+   * along the line. So the curvature is least where the tower projects onto the
+   * line, and grows with the distance from there. Over the move it's largest at
+   * whichever end is farther from the projection.
+   */
+  float kinematic_curvature(const xyz_pos_t &start, const xyz_float_t &unit, const_float_t length) {
+    const float uxy2 = HYPOT2(unit.x, unit.y);
+    if (!uxy2) return 0;  // No XY motion. The towers move together.
+    float curvature = 0;
+    LOOP_ABC(t) {
+      const xy_float_t d0 = { start.x - delta_tower[t].x, start.y - delta_tower[t].y };
+      const float nearest = -(d0.x * unit.x + d0.y * unit.y) / uxy2,  // Distance along the move to the projection
+                  far = nearest > length * 0.5f ? 0 : length;
+      const xy_float_t d = { d0.x + unit.x * far, d0.y + unit.y * far };
+      const float q = delta_diagonal_rod_2_tower[t] - HYPOT2(d.x, d.y);
+      if (q <= 0) return __FLT_MAX__;  // Out of reach. Don't reduce the segments.
+      NOLESS(curvature, (uxy2 * q + sq(d.x * unit.x + d.y * unit.y)) / (q * SQRT(q)));
+    }
+    return curvature;
+  }
+
+#endif
+
 /**
  * Delta Forward Kinematics
  *
@@ -162,7 +222,7 @@ float delta_safe_distance_from_top() {
  *
  * The result is stored in the cartes[] array.
  */
-void forward_kinematics(const_float_t z1, const_float_t z2, const_float_t z3) {
+static void delta_trilateration(const_float_t z1, const_float_t z2, const_float_t z3) {
   // Create a vector in old coordinates along x axis of new coordinate
   const float p12[3] = { delta_tower[B_AXIS].x - delta_tower[A_AXIS].x, delta_tower[B_AXIS].y - delta_tower[A_AXIS].y, z2 - z1 },
 
@@ -213,6 +273,97 @@ void forward_kinematics(const_float_t z1, const_float_t z2, const_float_t z3) {
                                 z1 + ex[2] * Xnew + ey[2] * Ynew - ez[2] * Znew);
 }
 
+#if ENABLED(DELTA_CACHED_FK)
+
+  /**
+   * Forward kinematics with the constants from recalc_delta_settings().
+   * Subtracting tower A's rod equation from B's and C's gives
+   *   M * XY = e - 2 * dh * Z
+   * so XY = u + v * Z. Putting this into tower A's equation leaves
+   *   a * Z^2 + 2 * b * Z + c = 0
+   * with the effector at the lower root. This takes a single square root
+   * where the trilateration takes three (two of them reciprocal).
+   */
+  void forward_kinematics(const_float_t z1, const_float_t z2, const_float_t z3) {
+    const abc_float_t h = { z1, z2, z3 };
+
+    // Repeated queries (e.g., M114 while idle) return the last solution
+    if (fk.valid && h == fk.last_abc) { cartes = fk.last; return; }
+
+    const xy_float_t dh = { z2 - z1, z3 - z1 },
+                     e = { fk.k.b - fk.k.a + sq(z2) - sq(z1), fk.k.c - fk.k.a + sq(z3) - sq(z1) },
+                     u = { fk.m_inv[0].x * e.x + fk.m_inv[0].y * e.y, fk.m_inv[1].x * e.x + fk.m_inv[1].y * e.y },
+                     v = { -2 * (fk.m_inv[0].x * dh.x + fk.m_inv[0].y * dh.y), -2 * (fk.m_inv[1].x * dh.x + fk.m_inv[1].y * dh.y) },
+                     ua = u - delta_tower[A_AXIS];
+
+    const float a = HYPOT2(v.x, v.y) + 1,
+                b = ua.x * v.x + ua.y * v.y - z1,
+                c = HYPOT2(ua.x, ua.y) + sq(z1) - delta_diagonal_rod_2_tower.a,
+                disc = sq(b) - a * c;
+
+    // Out of reach. Leave it to the trilateration.
+    if (disc < 0) { delta_trilateration(z1, z2, z3); return; }
+
+    const float z = (-b - SQRT(disc)) / a;
+    cartes.set(u.x + v.x * z, u.y + v.y * z, z);
+
+    fk.last_abc = h;
+    fk.last = cartes;
+    fk.valid = true;
+  }
+
+  #if ENABLED(MARLIN_TEST_BUILD)
+
+    /**
+     * Compare the cached forward kinematics to the trilateration for carriage
+     * positions over the print area and report the evaluations per second of
+     * each, with the first query of each point missing the cache. Both solve
+     * the same equations, so they must agree to within float rounding (1um).
+     */
+    void test_delta_fk() {
+      constexpr uint16_t points = 256;
+
+      auto test_carriages = [](const uint16_t i) -> abc_float_t {
+        const float r = DELTA_PRINTABLE_RADIUS * (i % 16) / 15.0f,
+                    angle = RADIANS((i / 16) * (360.0f / (points / 16)));
+        inverse_kinematics(xyz_pos_t({ r * cos(angle), r * sin(angle), float((i * 7) % 50) }));
+        return delta;
+      };
+
+      abc_float_t carriages[points];
+      for (uint16_t i = 0; i < points; ++i) carriages[i] = test_carriages(i);
+
+      float worst = 0;
+      for (uint16_t i = 0; i < points; ++i) {
+        delta_trilateration(carriages[i].a, carriages[i].b, carriages[i].c);
+        const xyz_pos_t ref = cartes;
+        forward_kinematics(carriages[i]);
+        NOLESS(worst, (cartes - ref).magnitude());
+      }
+
+      auto rate = [&carriages](void (*fwd)(const_float_t, const_float_t, const_float_t), const uint8_t repeat) {
+        return test_calls_per_second([&](const uint32_t i) {
+          const abc_float_t &c = carriages[(i / repeat) % points];
+          fwd(c.a, c.b, c.c);
+        });
+      };
+
+      SERIAL_ECHOLNPGM("Delta FK per second, trilateration: ", rate(delta_trilateration, 1),
+                       " cached: ", rate(forward_kinematics, 1),
+                       " cached, each point 4 times: ", rate(forward_kinematics, 4));
+      test_max_error(F("Delta FK cached max position error"), worst * 1000, 1, F("um"));
+    }
+
+  #endif
+
+#else
+
+  void forward_kinematics(const_float_t z1, const_float_t z2, const_float_t z3) {
+    delta_trilateration(z1, z2, z3);
+  }
+
+#endif
+
 /**
  * A delta can only safely home all axes at the same time
  * This is like quick_home_xy() but for 3 towers.
@@ -89,6 +89,15 @@ void inverse_kinematics(const xyz_pos_t &raw);
  */
 float delta_safe_distance_from_top();
 
+#ifdef DELTA_SEGMENT_DEVIATION
+  /**
+   * Get the largest curvature of the tower paths (1/mm) along a move of
+   * 'length' from 'start' in the direction of 'unit'. A segment of length L
+   * strays from the towers' true paths by about L^2 / 8 times this.
+   */
+  float kinematic_curvature(const xyz_pos_t &start, const xyz_float_t &unit, const_float_t length);
+#endif
+
 void refresh_delta_clip_start_height();
 
 /**
@@ -122,4 +131,8 @@ FORCE_INLINE void forward_kinematics(const abc_float_t &point) {
   forward_kinematics(point.a, point.b, point.c);
 }
 
+#if BOTH(DELTA_CACHED_FK, MARLIN_TEST_BUILD)
+  void test_delta_fk();
+#endif
+
 void home_delta();
@@ -0,0 +1,309 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2022 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../inc/MarlinConfig.h"
+
+#if ENABLED(FT_MOTION)
+
+#include "ft_motion.h"
+#include "stepper.h"
+
+FTMotion ftMotion;
+
+bool FTMotion::active; // = false
+
+ft_command_t FTMotion::commands[FTM_BUFFER_SIZE];
+volatile uint16_t FTMotion::cmd_head, FTMotion::cmd_tail;
+volatile bool FTMotion::abort_pending;
+
+block_t *FTMotion::cur_block; // = nullptr
+float FTMotion::block_time,
+      FTMotion::t_accel, FTMotion::t_cruise, FTMotion::t_decel,
+      FTMotion::v_initial, FTMotion::v_peak,
+      FTMotion::accel;
+xyze_long_t FTMotion::block_start;
+xyze_float_t FTMotion::block_ratio, FTMotion::last_target;
+xyze_long_t FTMotion::emitted;
+axis_bits_t FTMotion::last_dir_bits;
+
+#if ENABLED(FTM_PRESSURE_ADVANCE)
+  xyze_float_t FTMotion::pa_hist[pa_window + 1];
+  float FTMotion::pa_e_hist[pa_window + 1], FTMotion::pa_e, FTMotion::pa_k;
+  #if HAS_MULTI_EXTRUDER
+    uint8_t FTMotion::pa_extruder; // = 0
+  #endif
+  uint16_t FTMotion::pa_head, FTMotion::pa_settle;
+#endif
+
+/**
+ * Switch between Fixed-Time Motion and the trapezoid generator.
+ * All motion is completed before the switch.
+ */
+void FTMotion::set_active(const bool onoff) {
+  planner.synchronize();
+  const bool was_enabled = stepper.suspend();
+  active = onoff;
+  cur_block = nullptr;
+  cmd_head = cmd_tail = 0;
+  abort_pending = false;
+  if (onoff) sync_position();
+  if (was_enabled) stepper.wake_up();
+}
+
+// Continue from the current stepper position. Call only with the Stepper ISR suspended.
+void FTMotion::sync_position() {
+  emitted = stepper.count_position;
+  block_start = emitted;
+  LOOP_LOGICAL_AXES(i) last_target[i] = emitted[i];
+  last_dir_bits = stepper.last_direction_bits;
+  TERN_(FTM_PRESSURE_ADVANCE, pa_reset());
+}
+
+/**
+ * Fetch the next motion block from the planner and compute its velocity profile.
+ * Sync blocks are applied once the Stepper ISR has played all prior commands.
+ * Return false if there's no block ready to sample.
+ */
+bool FTMotion::load_block() {
+  block_t *block;
+  while ((block = planner.get_current_block()) && block->is_sync()) {
+    if (cmd_head != cmd_tail || TERN0(FTM_PRESSURE_ADVANCE, pa_settle)) return false;
+
+    TERN_(LASER_SYNCHRONOUS_M106_M107, if (block->is_fan_sync()) planner.sync_fan_speeds(block->fan_speed));
+
+    if (!(block->is_fan_sync() || block->is_pwr_sync())) {
+      const bool was_enabled = stepper.suspend();
+      stepper._set_position(block->position);
+      sync_position();
+      if (was_enabled) stepper.wake_up();
+    }
+
+    planner.release_current_block();
+  }
+  if (!block) return false;
+
+  /**
+   * The profile is derived from the block's step rates, so each phase is exact:
+   *   accelerate from initial_rate to v_peak, cruise, decelerate to final_rate.
+   */
+  const float n = block->step_event_count,
+              vf = block->final_rate;
+  v_initial = block->initial_rate;
+  accel = block->acceleration_steps_per_s2;
+  if (accel > 0) {
+    v_peak = _MIN(float(block->nominal_rate), SQRT((2 * accel * n + sq(v_initial) + sq(vf)) * 0.5f));
+    NOLESS(v_peak, _MAX(v_initial, vf));
+    const float d_accel = (sq(v_peak) - sq(v_initial)) / (2 * accel),
+                d_decel = (sq(v_peak) - sq(vf)) / (2 * accel);
+    t_accel = (v_peak - v_initial) / accel;
+    t_decel = (v_peak - vf) / accel;
+    t_cruise = _MAX(0.0f, n - d_accel - d_decel) / v_peak;
+  }
+  else {
+    v_peak = block->nominal_rate;
+    t_accel = t_decel = 0;
+    t_cruise = n / v_peak;
+  }
+
+  LOOP_LOGICAL_AXES(i) {
+    const float r = block->steps[i] / n;
+    block_ratio[i] = TEST(block->direction_bits, i) ? -r : r;
+  }
+
+  #if ENABLED(FTM_PRESSURE_ADVANCE)
+    #if HAS_MULTI_EXTRUDER
+      // The E history of the last extruder doesn't apply to this one
+      if (block->extruder != pa_extruder) {
+        pa_extruder = block->extruder;
+        LOOP_L_N(n, pa_window + 1) pa_e_hist[n] = pa_e;
+      }
+    #endif
+    pa_k = planner.extruder_advance_K[block->extruder];
+  #endif
+
+  block_time = 0;
+  cur_block = block;
+  return true;
+}
+
+// Step events completed at the given time into the current block
+float FTMotion::block_distance(const float t) {
+  if (t < t_accel)
+    return (v_initial + 0.5f * accel * t) * t;
+  const float d_accel = (v_initial + v_peak) * 0.5f * t_accel;
+  if (t < t_accel + t_cruise)
+    return d_accel + v_peak * (t - t_accel);
+  const float td = t - t_accel - t_cruise;
+  return d_accel + v_peak * t_cruise + (v_peak - 0.5f * accel * td) * td;
+}
+
+#if ENABLED(NATIVE_ARCS)
+
+  // Put the plane axes of an arc block on the arc, the given step events along
+  void FTMotion::arc_target(xyze_float_t &target, const float s) {
+    const block_arc_t &arc = cur_block->arc;
+    const float a0 = arc.start_angle,
+                a = a0 + arc.angular_travel * (s / cur_block->step_event_count);
+    target[arc.axis_p] = block_start[arc.axis_p] + arc.radius * (cosf(a) - cosf(a0)) * planner.settings.axis_steps_per_mm[arc.axis_p];
+    target[arc.axis_q] = block_start[arc.axis_q] + arc.radius * (sinf(a) - sinf(a0)) * planner.settings.axis_steps_per_mm[arc.axis_q];
+  }
+
+#endif
+
+#if ENABLED(FTM_PRESSURE_ADVANCE)
+
+  // Start the history at rest at the current position
+  void FTMotion::pa_reset() {
+    LOOP_L_N(n, pa_window + 1) {
+      LOOP_LOGICAL_AXES(i) pa_hist[n][i] = emitted[i];
+      pa_e_hist[n] = 0;
+    }
+    pa_e = 0;
+    pa_head = pa_settle = 0;
+  }
+
+  /**
+   * Add a sample to the history and get the target to send in its place.
+   *
+   * All axes are sent half a window late so the E velocity can be averaged
+   * over a window centered on the sample. E leads by K times that velocity,
+   * so the advance follows a speed change smoothly over the whole window
+   * instead of jumping with it. Only moves that use advance are counted,
+   * as with LIN_ADVANCE, so retracts aren't advanced.
+   */
+  xyze_float_t FTMotion::pressure_advance(const xyze_float_t &target, const float adv_e) {
+    pa_head = pa_head == pa_window ? 0 : pa_head + 1;
+    pa_hist[pa_head] = target;
+    pa_e_hist[pa_head] = adv_e;
+
+    const uint16_t oldest = pa_head == pa_window ? 0 : pa_head + 1,
+                   middle = (pa_head + pa_window / 2 + 1) % (pa_window + 1);
+    xyze_float_t out = pa_hist[middle];
+    out.e += pa_k * (pa_e_hist[pa_head] - pa_e_hist[oldest]) * (float(FTM_FS) / pa_window);
+    return out;
+  }
+
+#endif
+
+// Interpolate from the last sample to the new target, emitting one command per Stepper ISR tick
+void FTMotion::generate_sample(const xyze_float_t &target) {
+  xyze_float_t pos = last_target, inc;
+  LOOP_LOGICAL_AXES(i) inc[i] = (target[i] - last_target[i]) * (1.0f / (FTM_STEPS_PER_SAMPLE));
+
+  LOOP_L_N(t, FTM_STEPS_PER_SAMPLE) {
+    ft_command_t &cmd = commands[cmd_head];
+    cmd.step_bits = 0;
+    LOOP_LOGICAL_AXES(i) {
+      pos[i] += inc[i];
+      const int32_t want = LROUND(pos[i]);
+      if (want != emitted[i]) {
+        const bool rev = want < emitted[i];
+        SET_BIT_TO(last_dir_bits, i, rev);
+        SBI(cmd.step_bits, i);
+        emitted[i] += rev ? -1 : 1;
+      }
+    }
+    cmd.dir_bits = last_dir_bits;
+    cmd_head = next_cmd(cmd_head);
+  }
+
+  last_target = target;
+}
+
+/**
+ * Sample the planned trajectory every 1/FTM_FS seconds while there's room
+ * in the command buffer. A sample may span the end of one block and the
+ * start of the next, so the sample period stays constant between blocks.
+ */
+void FTMotion::loop() {
+  if (!active) return;
+
+  if (abort_pending) {
+    // The Stepper ISR dropped all motion, as with an endstop hit or a quick stop.
+    // The planner has already dropped its blocks, so start over from here.
+    const bool was_enabled = stepper.suspend();
+    cur_block = nullptr;
+    cmd_tail = cmd_head;
+    sync_position();
+    abort_pending = false;
+    if (was_enabled) stepper.wake_up();
+  }
+
+  while (!abort_pending && cmd_free() >= FTM_STEPS_PER_SAMPLE) {
+    float dt = 1.0f / (FTM_FS);
+    xyze_float_t target = last_target;
+    bool sampled = false;
+    #if ENABLED(FTM_PRESSURE_ADVANCE)
+      float adv_e = pa_e;
+    #endif
+
+    while (dt > 0 && (cur_block || load_block())) {
+      const float t_end = t_accel + t_cruise + t_decel;
+      if (block_time + dt < t_end) {
+        block_time += dt;
+        dt = 0;
+        const float s = block_distance(block_time);
+        LOOP_LOGICAL_AXES(i) target[i] = block_start[i] + s * block_ratio[i];
+        TERN_(NATIVE_ARCS, if (cur_block->is_arc()) arc_target(target, s));
+        TERN_(FTM_PRESSURE_ADVANCE, if (cur_block->la_advance_rate) adv_e = pa_e + target.e - block_start.e);
+      }
+      else {
+        // Finish the block exactly where the planner put it
+        dt -= t_end - block_time;
+        #if ENABLED(FTM_PRESSURE_ADVANCE)
+          if (cur_block->la_advance_rate) {
+            pa_e += cur_block->steps.e;
+            if (pa_e > 65536) {                 // Keep the history small enough for float precision
+              pa_e -= 65536;
+              LOOP_L_N(n, pa_window + 1) pa_e_hist[n] -= 65536;
+            }
+          }
+          adv_e = pa_e;
+        #endif
+        LOOP_LOGICAL_AXES(i) {
+          block_start[i] += TEST(cur_block->direction_bits, i) ? -int32_t(cur_block->steps[i]) : int32_t(cur_block->steps[i]);
+          target[i] = block_start[i];
+        }
+        planner.release_current_block();
+        cur_block = nullptr;
+      }
+      sampled = true;
+    }
+
+    #if ENABLED(FTM_PRESSURE_ADVANCE)
+      // Keep sampling at rest until the delayed samples have all been sent
+      if (sampled)
+        pa_settle = pa_window;
+      else if (pa_settle) {
+        pa_settle--;
+        target = pa_hist[pa_head];
+        adv_e = pa_e;
+        sampled = true;
+      }
+    #endif
+
+    if (!sampled) break;
+    generate_sample(TERN(FTM_PRESSURE_ADVANCE, pressure_advance(target, adv_e), target));
+  }
+}
+
+#endif // FT_MOTION
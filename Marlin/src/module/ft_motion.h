@@ -0,0 +1,123 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2022 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * Fixed-Time Motion
+ *
+ * An alternative to the trapezoid generator in the Stepper ISR. Planner blocks
+ * are sampled at a fixed period (FTM_FS) into per-axis position targets, which
+ * are interpolated into a buffer of step/direction commands. The Stepper ISR
+ * then runs at a fixed rate (FTM_STEPPER_FS) and only plays back one command
+ * per tick, so all the floating point math happens in the main loop.
+ */
+
+#include "planner.h"
+
+// One Stepper ISR tick worth of output
+typedef struct {
+  axis_bits_t step_bits,  // Axes to step on this tick
+              dir_bits;   // Direction bits (set = reverse), as in block_t::direction_bits
+} ft_command_t;
+
+#define FTM_STEPS_PER_SAMPLE ((FTM_STEPPER_FS) / (FTM_FS))
+#define FTM_STEPPER_TICKS    ((STEPPER_TIMER_RATE) / (FTM_STEPPER_FS))
+
+class FTMotion {
+  public:
+    static bool active;                     // Use Fixed-Time Motion instead of the trapezoid generator
+
+    static void set_active(const bool onoff);
+
+    // Generate step commands from planner blocks. Called from idle().
+    static void loop();
+
+    // Blocks or step commands are still pending
+    static bool busy() { return cur_block || cmd_head != cmd_tail || TERN0(FTM_PRESSURE_ADVANCE, pa_settle); }
+
+    // Get the next command for the Stepper ISR. Return false if none are ready.
+    static bool next_command(ft_command_t &cmd) {
+      if (abort_pending || cmd_head == cmd_tail) return false;
+      cmd = commands[cmd_tail];
+      cmd_tail = next_cmd(cmd_tail);
+      return true;
+    }
+
+    // Drop all pending commands. Called from the Stepper ISR to abort motion.
+    static void abort() { abort_pending = true; cmd_tail = cmd_head; }
+
+  private:
+    static ft_command_t commands[FTM_BUFFER_SIZE];
+    static volatile uint16_t cmd_head, cmd_tail;
+    static volatile bool abort_pending;
+
+    static block_t *cur_block;              // The block being sampled
+    static float block_time,                // (s) Time elapsed in the current block
+                 t_accel, t_cruise, t_decel,// (s) Duration of each block phase
+                 v_initial, v_peak,         // (steps/s) Entry and plateau step rates
+                 accel;                     // (steps/s²) Block acceleration
+    static xyze_long_t block_start;         // (steps) Motor positions at the start of the block
+    static xyze_float_t block_ratio,        // Signed motor steps per step event
+                        last_target;        // (steps) Target at the previous sample
+    static xyze_long_t emitted;             // (steps) Position reached by the generated commands
+    static axis_bits_t last_dir_bits;
+
+    #if ENABLED(FTM_PRESSURE_ADVANCE)
+      static constexpr uint16_t pa_window = 2 * uint16_t((FTM_PA_SMOOTH_TIME) * (FTM_FS) * 0.5f + 0.5f);
+      static xyze_float_t pa_hist[pa_window + 1]; // (steps) Recent samples, the newest at pa_head
+      static float pa_e_hist[pa_window + 1];      // (steps) E of the same samples, counting only advanced moves
+      static float pa_e,                          // (steps) Advanced E at the start of the current block
+                   pa_k;                          // K of the extruder the current block moves
+      #if HAS_MULTI_EXTRUDER
+        static uint8_t pa_extruder;               // Extruder the E history belongs to
+      #endif
+      static uint16_t pa_head,
+                      pa_settle;                  // Samples to go until the delayed output is at rest
+      static void pa_reset();
+      static xyze_float_t pressure_advance(const xyze_float_t &target, const float adv_e);
+    #endif
+
+    static uint16_t next_cmd(const uint16_t i) { return i + 1 == FTM_BUFFER_SIZE ? 0 : i + 1; }
+    static uint16_t cmd_free() {
+      const int16_t used = cmd_head - cmd_tail;
+      return FTM_BUFFER_SIZE - 1 - (used < 0 ? used + FTM_BUFFER_SIZE : used);
+    }
+
+    static void sync_position();
+    static bool load_block();
+    static float block_distance(const float t);
+    #if ENABLED(NATIVE_ARCS)
+      static void arc_target(xyze_float_t &target, const float s);
+    #endif
+    static void generate_sample(const xyze_float_t &target);
+};
+
+extern FTMotion ftMotion;
+
+// Suspend Fixed-Time Motion while in scope, e.g., for homing and probing
+class FTMotionDisableInScope {
+  public:
+    FTMotionDisableInScope() { was_active = ftMotion.active; if (was_active) ftMotion.set_active(false); }
+    ~FTMotionDisableInScope() { if (was_active) ftMotion.set_active(true); }
+  private:
+    bool was_active;
+};
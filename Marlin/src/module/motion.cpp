@@ -62,6 +62,10 @@
   #include "../feature/fwretract.h"
 #endif
 
+#if ENABLED(SEGMENT_COALESCING)
+  #include "../feature/coalescer.h"
+#endif
+
 #if ENABLED(BABYSTEP_DISPLAY_TOTAL)
   #include "../feature/babystep.h"
 #endif
@@ -1060,6 +1064,12 @@ FORCE_INLINE void segment_idle(millis_t &next_idle_ms) {
     #define SCARA_MIN_SEGMENT_LENGTH 0.5f
   #endif
 
+  #ifdef DELTA_SEGMENT_DEVIATION
+    #define KINEMATIC_SEGMENT_DEVIATION DELTA_SEGMENT_DEVIATION
+  #elif defined(SCARA_SEGMENT_DEVIATION)
+    #define KINEMATIC_SEGMENT_DEVIATION SCARA_SEGMENT_DEVIATION
+  #endif
+
   /**
    * Prepare a linear move in a DELTA or SCARA setup.
    *
@@ -1112,6 +1122,17 @@ FORCE_INLINE void segment_idle(millis_t &next_idle_ms) {
       NOMORE(segments, cartesian_mm * RECIPROCAL(SCARA_MIN_SEGMENT_LENGTH));
     #endif
 
+    #ifdef KINEMATIC_SEGMENT_DEVIATION
+    {
+      // Use fewer segments where the joints move almost linearly. Straight
+      // joint moves of length L stray about L^2 / 8 times the curvature.
+      const xyz_float_t unit = xyz_float_t(diff) / cartesian_mm;
+      const float curvature = kinematic_curvature(current_position, unit, cartesian_mm),
+                  needed = cartesian_mm * SQRT(curvature * (1.0f / (8.0f * (KINEMATIC_SEGMENT_DEVIATION))));
+      if (needed < segments) segments = CEIL(needed);
+    }
+    #endif
+
     // At least one segment is required
     NOLESS(segments, 1U);
 
@@ -1252,7 +1273,11 @@ FORCE_INLINE void segment_idle(millis_t &next_idle_ms) {
       }
     #endif // HAS_MESH
 
-    planner.buffer_line(destination, scaled_fr_mm_s);
+    #if ENABLED(SEGMENT_COALESCING)
+      coalescer.add(current_position, destination, scaled_fr_mm_s);
+    #else
+      planner.buffer_line(destination, scaled_fr_mm_s);
+    #endif
     return false; // caller will update current_position
   }
 
@@ -110,6 +110,14 @@
   #include "../feature/spindle_laser.h"
 #endif
 
+#if ENABLED(FT_MOTION)
+  #include "ft_motion.h"
+#endif
+
+#if ENABLED(SEGMENT_COALESCING)
+  #include "../feature/coalescer.h"
+#endif
+
 // Delay for delivery of first block to the stepper ISR, if the queue contains 2 or
 // fewer movements. The delay is measured in milliseconds, and must be less than 250ms
 #define BLOCK_DELAY_FOR_1ST_MOVE 100
@@ -151,6 +159,15 @@ float Planner::mm_per_step[DISTINCT_AXES];      // (mm) Millimeters per step
   #endif
 #endif
 
+#if ENABLED(PATH_BLENDING)
+  float Planner::blend_tolerance; // = 0      // (mm) G64 P
+  Planner::blend_state_t Planner::blend;
+#endif
+
+#if ENABLED(PLANNER_KERNEL_STATS)
+  Planner::kernel_stats_t Planner::kernel_stats; // = { 0 }
+#endif
+
 #if HAS_CLASSIC_JERK
   TERN(HAS_LINEAR_E_JERK, xyz_pos_t, xyze_pos_t) Planner::max_jerk;
 #endif
@@ -182,6 +199,13 @@ float Planner::mm_per_step[DISTINCT_AXES];      // (mm) Millimeters per step
 #if ENABLED(VOLUMETRIC_EXTRUDER_LIMIT)
   float Planner::volumetric_extruder_limit[EXTRUDERS],          // max mm^3/sec the extruder is able to handle
         Planner::volumetric_extruder_feedrate_limit[EXTRUDERS]; // pre calculated extruder feedrate limit based on volumetric_extruder_limit; pre-calculated to reduce computation in the planner
+  #if ENABLED(VOLUMETRIC_LIMIT_BY_TEMP)
+    float Planner::volumetric_extruder_limit_scale[EXTRUDERS] = ARRAY_BY_EXTRUDERS1(VOLUMETRIC_LIMIT_MIN_SCALE);
+  #endif
+#endif
+
+#if ENABLED(NONLINEAR_EXTRUSION)
+  nonlinear_extrusion_t Planner::nonlinear_extrusion[EXTRUDERS]; // E multiplier coefficients by volumetric flow
 #endif
 
 #if HAS_LEVELING
@@ -769,6 +793,34 @@ block_t* Planner::get_current_block() {
   return nullptr;
 }
 
+#if ENABLED(S_CURVE_JERK_LIMIT)
+
+  /**
+   * Get the highest speed (squared) from which a jerk-limited ramp can change
+   * to the given speed within 'distance' (mm).
+   *
+   * Long ramps reach the reduced peak acceleration, so they follow the usual
+   * formula. Shorter ramps are limited by jerk, where the ramp by 'dv' needs
+   * (2v + dv)·√dv / (2√(j·√3/10)) mm. That's a convex cubic in √dv, which is
+   * solved by Newton's method starting from an upper bound.
+   */
+  float Planner::s_curve_speed_sqr(const_float_t accel, const_float_t target_velocity_sqr, const_float_t distance) {
+    constexpr float jerk_c = (S_CURVE_MAX_JERK) * 0.17320508f;  // j·√3/10
+    const float a = accel * (8.0f / 15.0f),
+                full_sqr = target_velocity_sqr + 2 * a * distance,
+                v = SQRT(target_velocity_sqr),
+                dv_full = sq(a) / jerk_c;                       // Shortest ramp reaching the peak acceleration
+    if (SQRT(full_sqr) - v >= dv_full) return full_sqr;
+
+    const float p = 2 * v, k = 2 * distance * SQRT(jerk_c);
+    float y = _MIN(SQRT(dv_full), cbrtf(k));
+    if (p > 0) NOMORE(y, k / p);
+    LOOP_L_N(i, 4) y -= (y * (sq(y) + p) - k) / (3 * sq(y) + p);
+    return sq(v + sq(y));
+  }
+
+#endif
+
 /**
  * Calculate trapezoid parameters, multiplying the entry- and exit-speeds
  * by the provided factors.
@@ -781,6 +833,8 @@ block_t* Planner::get_current_block() {
  */
 void Planner::calculate_trapezoid_for_block(block_t * const block, const_float_t entry_factor, const_float_t exit_factor) {
 
+  TERN_(PLANNER_KERNEL_STATS, ++kernel_stats.trapezoid);
+
   uint32_t initial_rate = CEIL(block->nominal_rate * entry_factor),
            final_rate = CEIL(block->nominal_rate * exit_factor); // (steps per second)
 
@@ -800,6 +854,43 @@ void Planner::calculate_trapezoid_for_block(block_t * const block, const_float_t
   uint32_t accelerate_steps = 0,
            decelerate_steps = 0;
 
+  #if ENABLED(S_CURVE_JERK_LIMIT)
+
+    // Trapezoid acceleration for each ramp, keeping the Bézier within the acceleration and jerk
+    const float jerk = (S_CURVE_MAX_JERK) * block->step_event_count / block->millimeters;
+    float accel_up = accel, accel_down = accel;
+
+    if (accel != 0) {
+      const float nominal = block->nominal_rate;
+      float accelerate_steps_float = s_curve_distance(initial_rate, nominal, accel, jerk),
+            decelerate_steps_float = s_curve_distance(nominal, final_rate, accel, jerk);
+
+      // If the block is too short to reach the nominal rate, find the highest
+      // rate that it can ramp up to and back down from in its length.
+      if (accelerate_steps_float + decelerate_steps_float > block->step_event_count) {
+        float lo = _MAX(initial_rate, final_rate), hi = nominal;
+        LOOP_L_N(i, 16) {
+          const float mid = 0.5f * (lo + hi);
+          if (s_curve_distance(initial_rate, mid, accel, jerk) + s_curve_distance(mid, final_rate, accel, jerk) > block->step_event_count)
+            hi = mid;
+          else
+            lo = mid;
+        }
+        cruise_rate = lo;
+        accelerate_steps_float = s_curve_distance(initial_rate, lo, accel, jerk);
+        decelerate_steps_float = s_curve_distance(lo, final_rate, accel, jerk);
+      }
+
+      accelerate_steps = _MIN(uint32_t(CEIL(accelerate_steps_float)), block->step_event_count);
+      decelerate_steps = _MIN(uint32_t(FLOOR(decelerate_steps_float)), block->step_event_count - accelerate_steps);
+      plateau_steps -= accelerate_steps + decelerate_steps;
+
+      if (cruise_rate > initial_rate) accel_up = s_curve_accel(accel, jerk, cruise_rate - initial_rate);
+      if (cruise_rate > final_rate) accel_down = s_curve_accel(accel, jerk, cruise_rate - final_rate);
+    }
+
+  #else
+
   if (accel != 0) {
     // Steps required for acceleration, deceleration to/from nominal rate
     const float nominal_rate_sq = sq(float(block->nominal_rate));
@@ -827,10 +918,12 @@ void Planner::calculate_trapezoid_for_block(block_t * const block, const_float_t
     }
   }
 
+  #endif // !S_CURVE_JERK_LIMIT
+
   #if ENABLED(S_CURVE_ACCELERATION)
     // Jerk controlled speed requires to express speed versus time, NOT steps
-    uint32_t acceleration_time = (float(cruise_rate - initial_rate) / accel) * (STEPPER_TIMER_RATE),
-             deceleration_time = (float(cruise_rate - final_rate) / accel) * (STEPPER_TIMER_RATE),
+    uint32_t acceleration_time = (float(cruise_rate - initial_rate) / TERN(S_CURVE_JERK_LIMIT, accel_up, accel)) * (STEPPER_TIMER_RATE),
+             deceleration_time = (float(cruise_rate - final_rate) / TERN(S_CURVE_JERK_LIMIT, accel_down, accel)) * (STEPPER_TIMER_RATE),
     // And to offload calculations from the ISR, we also calculate the inverse of those times here
              acceleration_time_inverse = get_period_inverse(acceleration_time),
              deceleration_time_inverse = get_period_inverse(deceleration_time);
@@ -1057,6 +1150,7 @@ void Planner::reverse_pass(TERN_(HINTS_SAFE_EXIT_SPEED, const_float_t safe_exit_
 
     // Only process movement blocks
     if (current->is_move()) {
+      TERN_(PLANNER_KERNEL_STATS, ++kernel_stats.reverse);
       reverse_pass_kernel(current, next OPTARG(HINTS_SAFE_EXIT_SPEED, safe_exit_speed_sqr));
       next = current;
     }
@@ -1156,8 +1250,10 @@ void Planner::forward_pass() {
       // the previous block became BUSY, so assume the current block's
       // entry speed can't be altered (since that would also require
       // updating the exit speed of the previous block).
-      if (!previous || !stepper.is_block_busy(previous))
+      if (!previous || !stepper.is_block_busy(previous)) {
+        TERN_(PLANNER_KERNEL_STATS, ++kernel_stats.forward);
         forward_pass_kernel(previous, block, block_index);
+      }
       previous = block;
     }
     // Advance to the previous
@@ -1169,11 +1265,18 @@ void Planner::forward_pass() {
  * Recalculate the trapezoid speed profiles for all blocks in the plan
  * according to the entry_factor for each junction. Must be called by
  * recalculate() after updating the blocks.
+ *
+ * Blocks before start_index (the planned pointer ahead of the passes)
+ * kept their entry and exit speeds, so they are skipped.
  */
-void Planner::recalculate_trapezoids(TERN_(HINTS_SAFE_EXIT_SPEED, const_float_t safe_exit_speed_sqr)) {
+void Planner::recalculate_trapezoids(const uint8_t start_index OPTARG(HINTS_SAFE_EXIT_SPEED, const_float_t safe_exit_speed_sqr)) {
   // The tail may be changed by the ISR so get a local copy.
   uint8_t block_index = block_buffer_tail,
           head_block_index = block_buffer_head;
+
+  // Start at the planned block, unless the ISR has already moved past it
+  if (BLOCK_MOD(start_index - block_index) < BLOCK_MOD(head_block_index - block_index))
+    block_index = start_index;
   // Since there could be a sync block in the head of the queue, and the
   // next loop must not recalculate the head block (as it needs to be
   // specially handled), scan backwards to the first non-SYNC block.
@@ -1198,6 +1301,7 @@ void Planner::recalculate_trapezoids(TERN_(HINTS_SAFE_EXIT_SPEED, const_float_t
   while (block_index != head_block_index) {
 
     next = &block_buffer[block_index];
+    TERN_(PLANNER_KERNEL_STATS, ++kernel_stats.scanned);
 
     // Only process movement blocks
     if (next->is_move()) {
@@ -1264,12 +1368,14 @@ void Planner::recalculate_trapezoids(TERN_(HINTS_SAFE_EXIT_SPEED, const_float_t
 void Planner::recalculate(TERN_(HINTS_SAFE_EXIT_SPEED, const_float_t safe_exit_speed_sqr)) {
   // Initialize block index to the last block in the planner buffer.
   const uint8_t block_index = prev_block_index(block_buffer_head);
+  // The passes only change blocks after the planned block. Get it before they move it.
+  const uint8_t planned_index = block_buffer_planned;
   // If there is just one block, no planning can be done. Avoid it!
-  if (block_index != block_buffer_planned) {
+  if (block_index != planned_index) {
     reverse_pass(TERN_(HINTS_SAFE_EXIT_SPEED, safe_exit_speed_sqr));
     forward_pass();
   }
-  recalculate_trapezoids(TERN_(HINTS_SAFE_EXIT_SPEED, safe_exit_speed_sqr));
+  recalculate_trapezoids(planned_index OPTARG(HINTS_SAFE_EXIT_SPEED, safe_exit_speed_sqr));
 }
 
 /**
@@ -1532,12 +1638,37 @@ void Planner::check_axes_activity() {
    */
   void Planner::calculate_volumetric_extruder_limit(const uint8_t e) {
     const float &lim = volumetric_extruder_limit[e], &siz = filament_size[e];
-    volumetric_extruder_feedrate_limit[e] = (lim && siz) ? lim / CIRCLE_AREA(siz * 0.5f) : 0;
+    volumetric_extruder_feedrate_limit[e] = (lim && siz) ? lim * TERN1(VOLUMETRIC_LIMIT_BY_TEMP, volumetric_extruder_limit_scale[e]) / CIRCLE_AREA(siz * 0.5f) : 0;
   }
   void Planner::calculate_volumetric_extruder_limits() {
     EXTRUDER_LOOP() calculate_volumetric_extruder_limit(e);
   }
 
+  #if ENABLED(VOLUMETRIC_LIMIT_BY_TEMP)
+
+    /**
+     * Scale the volumetric limits by the melt capacity of each hotend.
+     * Capacity grows with the nozzle temperature above the melt temperature,
+     * and falls off as the heater runs out of power to keep up. Readings are
+     * averaged over about 8 samples so heater PWM noise doesn't reach the planner.
+     */
+    void Planner::update_volumetric_extruder_limits() {
+      EXTRUDER_LOOP() {
+        float scale = (thermalManager.degHotend(e) - (VOLUMETRIC_LIMIT_MELT_TEMP))
+                    / float((VOLUMETRIC_LIMIT_REF_TEMP) - (VOLUMETRIC_LIMIT_MELT_TEMP));
+        #if ANY(PIDTEMP, MPCTEMP)
+          // Fraction of heater power still available
+          const float headroom = 1.0f - thermalManager.getHeaterPower((heater_id_t)HOTEND_INDEX) / float(TERN(MPCTEMP, MPC_MAX, PID_MAX) >> 1);
+          if (headroom < (VOLUMETRIC_LIMIT_HEADROOM)) scale *= _MAX(headroom, 0.0f) / (VOLUMETRIC_LIMIT_HEADROOM);
+        #endif
+        LIMIT(scale, VOLUMETRIC_LIMIT_MIN_SCALE, VOLUMETRIC_LIMIT_MAX_SCALE);
+        volumetric_extruder_limit_scale[e] += (scale - volumetric_extruder_limit_scale[e]) * 0.125f;
+        calculate_volumetric_extruder_limit(e);
+      }
+    }
+
+  #endif
+
 #endif
 
 #if ENABLED(FILAMENT_WIDTH_SENSOR)
@@ -1680,6 +1811,10 @@ void Planner::quick_stop() {
 
   const bool was_enabled = stepper.suspend();
 
+  // Drop the moves held back for coalescing and blending
+  TERN_(SEGMENT_COALESCING, coalescer.discard());
+  TERN_(PATH_BLENDING, blend.pending = blend.valid = false);
+
   // Drop all queue entries
   block_buffer_nonbusy = block_buffer_planned = block_buffer_head = block_buffer_tail;
 
@@ -1785,10 +1920,30 @@ float Planner::get_axis_position_mm(const AxisEnum axis) {
   return axis_steps * mm_per_step[axis];
 }
 
+/**
+ * Blocks are queued, or we're running out moves, or the closed loop controller is waiting,
+ * or input shaping, Fixed-Time Motion, or the step event queue still have steps to issue,
+ * or a move is held back for segment coalescing or path blending
+ */
+bool Planner::busy() {
+  return (has_blocks_queued() || cleaning_buffer_counter
+      || TERN0(SEGMENT_COALESCING, coalescer.busy())
+      || TERN0(PATH_BLENDING, blend.pending)
+      || TERN0(EXTERNAL_CLOSED_LOOP_CONTROLLER, CLOSED_LOOP_WAITING())
+      || TERN0(HAS_SHAPING, stepper.input_shaping_busy())
+      || TERN0(FT_MOTION, ftMotion.busy())
+      || TERN0(STEP_EVENT_QUEUE, stepper.step_events_queued())
+  );
+}
+
 /**
  * Block until the planner is finished processing
  */
-void Planner::synchronize() { while (busy()) idle(); }
+void Planner::synchronize() {
+  TERN_(SEGMENT_COALESCING, coalescer.flush());
+  TERN_(PATH_BLENDING, blend_flush());
+  while (busy()) idle();
+}
 
 /**
  * @brief Add a new linear movement to the planner queue (in terms of steps).
@@ -1808,6 +1963,35 @@ bool Planner::_buffer_steps(const xyze_long_t &target
   , feedRate_t fr_mm_s, const uint8_t extruder, const PlannerHints &hints
 ) {
 
+  #if ENABLED(COMPACT_PLANNER_BLOCKS)
+    // Split a move too long for the 16-bit step counts into equal parts.
+    // Count E steps as _populate_block will scale them.
+    uint32_t most_steps = 0;
+    LOOP_NUM_AXES(i) NOLESS(most_steps, uint32_t(ABS(target[i] - position[i])));
+    #if HAS_EXTRUDERS
+      NOLESS(most_steps, uint32_t(ABS(target.e - position.e) * max_e_factor(extruder) + 0.5f));
+    #endif
+    const uint32_t parts = most_steps / BLOCK_SPLIT_STEPS + 1;
+    if (parts > 1) {
+      const xyze_long_t start = position;
+      #if HAS_POSITION_FLOAT
+        const xyze_pos_t start_float = position_float;
+      #endif
+      PlannerHints part_hints = hints;
+      part_hints.millimeters /= parts;
+      for (uint32_t n = 1; n <= parts; ++n) {
+        xyze_long_t part_target = target;
+        if (n < parts) LOOP_LOGICAL_AXES(i) part_target[i] = start[i] + int32_t(int64_t(target[i] - start[i]) * n / parts);
+        if (!_buffer_steps(part_target
+            OPTARG(HAS_POSITION_FLOAT, n < parts ? start_float + (target_float - start_float) * (float(n) / parts) : target_float)
+            OPTARG(HAS_DIST_MM_ARG, cart_dist_mm / float(parts))
+            , fr_mm_s, extruder, part_hints
+        )) return false;
+      }
+      return true;
+    }
+  #endif
+
   // Wait for the next available block
   uint8_t next_buffer_head;
   block_t * const block = get_next_free_block(next_buffer_head);
@@ -1842,6 +2026,8 @@ bool Planner::_buffer_steps(const xyze_long_t &target
   // Move buffer head
   block_buffer_head = next_buffer_head;
 
+  TERN_(PLANNER_KERNEL_STATS, ++kernel_stats.blocks);
+
   // Recalculate and optimize trapezoidal speed profiles
   recalculate(TERN_(HINTS_SAFE_EXIT_SPEED, hints.safe_exit_speed_sqr));
 
@@ -2002,7 +2188,12 @@ bool Planner::_populate_block(
   #if HAS_EXTRUDERS
     if (de < 0) SBI(dm, E_AXIS);
     const float esteps_float = de * e_factor[extruder];
-    const uint32_t esteps = ABS(esteps_float) + 0.5f;
+    #if ENABLED(NONLINEAR_EXTRUSION)
+      uint32_t esteps = ABS(esteps_float) + 0.5f;
+      float e_flow_factor = 1.0f;
+    #else
+      const uint32_t esteps = ABS(esteps_float) + 0.5f;
+    #endif
   #else
     constexpr uint32_t esteps = 0;
   #endif
@@ -2127,6 +2318,21 @@ bool Planner::_populate_block(
 
   TERN_(LCD_SHOW_E_TOTAL, e_move_accumulator += steps_dist_mm.e);
 
+  #if ENABLED(NATIVE_ARCS)
+    // Plan an arc as if both plane axes moved its whole length, which is the most
+    // either one can move at any point. The real steps are restored at the end.
+    const float arc_mm = hints.arc ? hints.arc->radius * ABS(hints.arc->angular_travel) : 0.0f;
+    if (hints.arc) {
+      block->flag.arc = true;
+      block->arc = *hints.arc;
+      LOOP_L_N(n, 2) {
+        const AxisEnum axis = n ? hints.arc->axis_q : hints.arc->axis_p;
+        steps_dist_mm[axis] = arc_mm;
+        block->steps[axis] = CEIL(arc_mm * settings.axis_steps_per_mm[axis]);
+      }
+    }
+  #endif
+
   #if BOTH(HAS_ROTATIONAL_AXES, INCH_MODE_SUPPORT)
     bool cartesian_move = true;
   #endif
@@ -2216,6 +2422,20 @@ bool Planner::_populate_block(
       block->millimeters = SQRT(distance_sqr);
     }
 
+    #if ENABLED(NONLINEAR_EXTRUSION)
+      // Extrude more at high flow, where the hotend falls behind
+      if (de > 0) {
+        float flow = steps_dist_mm.e * fr_mm_s / block->millimeters * CIRCLE_AREA(filament_size[extruder] * 0.5f);
+        #if ENABLED(VOLUMETRIC_EXTRUDER_LIMIT)
+          // The move will be slowed down to the limit
+          if (volumetric_extruder_limit[extruder]) NOMORE(flow, volumetric_extruder_limit[extruder]);
+        #endif
+        e_flow_factor = nonlinear_extrusion_factor(extruder, flow);
+        esteps = esteps_float * e_flow_factor + 0.5f;
+        steps_dist_mm.e *= e_flow_factor;
+      }
+    #endif
+
     /**
      * At this point at least one of the axes has more steps than
      * MIN_STEPS_PER_SEGMENT, ensuring the segment won't get dropped as
@@ -2433,8 +2653,10 @@ bool Planner::_populate_block(
       if (cs > max_fr) NOMORE(speed_factor, max_fr / cs); //respect max feedrate on any movement (doesn't matter if E axes only or not)
 
       #if ENABLED(VOLUMETRIC_EXTRUDER_LIMIT)
+        // With NONLINEAR_EXTRUSION the limit applies to the requested flow
         const feedRate_t max_vfr = volumetric_extruder_feedrate_limit[extruder]
-                                   * TERN(HAS_MIXER_SYNC_CHANNEL, MIXING_STEPPERS, 1);
+                                   * TERN(HAS_MIXER_SYNC_CHANNEL, MIXING_STEPPERS, 1)
+                                   * TERN1(NONLINEAR_EXTRUSION, e_flow_factor);
 
         // TODO: Doesn't work properly for joined segments. Set MIN_STEPS_PER_SEGMENT 1 as workaround.
 
@@ -2487,6 +2709,14 @@ bool Planner::_populate_block(
 
   #endif // XY_FREQUENCY_LIMIT
 
+  #if ENABLED(NATIVE_ARCS)
+    // Keep the centripetal acceleration of an arc within the limits of its axes
+    if (hints.arc) {
+      const float arc_speed_sqr = hints.arc->radius * _MIN(settings.max_acceleration_mm_per_s2[hints.arc->axis_p], settings.max_acceleration_mm_per_s2[hints.arc->axis_q]);
+      if (sq(block->nominal_speed) > arc_speed_sqr) NOMORE(speed_factor, SQRT(arc_speed_sqr) / block->nominal_speed);
+    }
+  #endif
+
   // Correct the speed
   if (speed_factor < 1.0f) {
     current_speed *= speed_factor;
@@ -2552,8 +2782,9 @@ bool Planner::_populate_block(
         // This assumes no one will use a retract length of 0mm < retr_length < ~0.2mm and no one will print 100mm wide lines using 3mm filament or 35mm wide lines using 1.75mm filament.
         if (e_D_ratio > 3.0f)
           use_advance_lead = false;
-        else {
+        else if (TERN1(FTM_PRESSURE_ADVANCE, !ftMotion.active)) {
           // Scale E acceleration so that it will be possible to jump to the advance speed.
+          // Fixed-Time Motion smooths the advance instead, so it needs no such limit.
           const uint32_t max_accel_steps_per_s2 = MAX_E_JERK(extruder) / (extruder_advance_K[extruder] * e_D_ratio) * steps_per_mm;
           if (TERN0(LA_DEBUG, accel > max_accel_steps_per_s2))
             SERIAL_ECHOLNPGM("Acceleration limited.");
@@ -2656,6 +2887,20 @@ bool Planner::_populate_block(
       #endif
     ;
 
+    #if ENABLED(NATIVE_ARCS)
+      // An arc meets its neighbors along its tangents at each end
+      xyze_float_t arc_end_vec;
+      if (hints.arc) {
+        const AxisEnum p = hints.arc->axis_p, q = hints.arc->axis_q;
+        const float a0 = hints.arc->start_angle, a1 = a0 + hints.arc->angular_travel,
+                    r = hints.arc->angular_travel < 0 ? -arc_mm : arc_mm;
+        arc_end_vec = unit_vec;
+        unit_vec[p] = -sinf(a0) * r;    unit_vec[q] = cosf(a0) * r;
+        arc_end_vec[p] = -sinf(a1) * r; arc_end_vec[q] = cosf(a1) * r;
+        normalize_junction_vector(arc_end_vec);
+      }
+    #endif
+
     /**
      * On CoreXY the length of the vector [A,B] is SQRT(2) times the length of the head movement vector [X,Y].
      * So taking Z and E into account, we cannot scale to a unit vector with "inverse_millimeters".
@@ -2802,7 +3047,7 @@ bool Planner::_populate_block(
     else // Init entry speed to zero. Assume it starts from rest. Planner will correct this later.
       vmax_junction_sqr = 0;
 
-    prev_unit_vec = unit_vec;
+    prev_unit_vec = TERN(NATIVE_ARCS, hints.arc ? arc_end_vec : unit_vec, unit_vec);
 
   #endif
 
@@ -2926,6 +3171,14 @@ bool Planner::_populate_block(
   previous_speed = current_speed;
   previous_nominal_speed = block->nominal_speed;
 
+  #if ENABLED(NATIVE_ARCS)
+    // Restore the steps that actually take the plane axes from start to end
+    if (hints.arc) LOOP_L_N(n, 2) {
+      const AxisEnum axis = n ? hints.arc->axis_q : hints.arc->axis_p;
+      block->steps[axis] = ABS(target[axis] - position[axis]);
+    }
+  #endif
+
   position = target;  // Update the position
 
   #if ENABLED(POWER_LOSS_RECOVERY)
@@ -2948,6 +3201,10 @@ bool Planner::_populate_block(
  */
 void Planner::buffer_sync_block(const BlockFlagBit sync_flag/*=BLOCK_BIT_SYNC_POSITION*/) {
 
+  // Sync after the held moves
+  TERN_(SEGMENT_COALESCING, coalescer.flush());
+  TERN_(PATH_BLENDING, blend_flush());
+
   // Wait for the next available block
   uint8_t next_buffer_head;
   block_t * const block = get_next_free_block(next_buffer_head);
@@ -3009,6 +3266,14 @@ bool Planner::buffer_segment(const abce_pos_t &abce
   // If we are cleaning, do not accept queuing of movements
   if (cleaning_buffer_counter) return false;
 
+  // Segments go after the held moves
+  TERN_(SEGMENT_COALESCING, coalescer.flush());
+  #if ENABLED(PATH_BLENDING)
+    // ...and leave the blend start unknown
+    blend_flush();
+    blend.valid = false;
+  #endif
+
   // When changing extruders recalculate steps corresponding to the E position
   #if ENABLED(DISTINCT_E_FACTORS)
     if (last_extruder != extruder && settings.axis_steps_per_mm[E_AXIS_N(extruder)] != settings.axis_steps_per_mm[E_AXIS_N(last_extruder)]) {
@@ -3126,10 +3391,13 @@ bool Planner::buffer_segment(const abce_pos_t &abce
  *  extruder        - optional target extruder (otherwise active_extruder)
  *  hints           - optional parameters to aid planner calculations
  */
-bool Planner::buffer_line(const xyze_pos_t &cart, const_feedRate_t fr_mm_s
+bool Planner::TERN(PATH_BLENDING, _buffer_line, buffer_line)(const xyze_pos_t &cart, const_feedRate_t fr_mm_s
   , const uint8_t extruder/*=active_extruder*/
   , const PlannerHints &hints/*=PlannerHints()*/
 ) {
+  // Lines go after the held moves
+  TERN_(SEGMENT_COALESCING, coalescer.flush());
+
   xyze_pos_t machine = cart;
   TERN_(HAS_POSITION_MODIFIERS, apply_modifiers(machine));
 
@@ -3179,6 +3447,148 @@ bool Planner::buffer_line(const xyze_pos_t &cart, const_feedRate_t fr_mm_s
   #endif
 } // buffer_line()
 
+#if ENABLED(PATH_BLENDING)
+
+  /**
+   * Buffer a line without blending and remember where it ends, since
+   * that's where the next line will start.
+   */
+  bool Planner::blend_line(const xyze_pos_t &cart, const_feedRate_t fr_mm_s, const uint8_t extruder, const_float_t curve_radius) {
+    PlannerHints hints;
+    hints.curve_radius = curve_radius;
+    const bool ok = _buffer_line(cart, fr_mm_s, extruder, hints);
+    if (ok) blend.start = cart;
+    blend.valid = ok;
+    return ok;
+  }
+
+  void Planner::blend_flush() {
+    if (!blend.pending) return;
+    blend.pending = false;
+    blend_line(blend.end, blend.fr_mm_s, blend.extruder, blend.curve_radius);
+  }
+
+  /**
+   * Add a new linear movement to the buffer with G64 path blending.
+   *
+   * Each line is held back until the next one arrives. If the two lines
+   * make a corner, the held line is cut short and the corner is replaced
+   * by an arc tangent to both lines that stays within blend_tolerance of
+   * the corner. The arc is buffered as a few chords and the new line is
+   * held back from the end of the arc.
+   *
+   * The arc radius goes to the planner as a curve radius hint so the
+   * junction speed is limited by the centripetal acceleration, just as
+   * it is for G2/G3 arcs, instead of by junction deviation.
+   */
+  bool Planner::buffer_line(const xyze_pos_t &cart, const_feedRate_t fr_mm_s
+    , const uint8_t extruder/*=active_extruder*/
+    , const PlannerHints &hints/*=PlannerHints()*/
+  ) {
+    if (cleaning_buffer_counter) return false;
+
+    TERN_(SEGMENT_COALESCING, coalescer.flush());
+
+    // Arcs and pre-segmented lines already carry their own hints
+    if (!blend_tolerance || !blend.valid || hints.millimeters || hints.curve_radius) {
+      blend_flush();
+      const bool ok = _buffer_line(cart, fr_mm_s, extruder, hints);
+      if (ok) blend.start = cart;
+      blend.valid = ok;
+      return ok;
+    }
+
+    // The new line starts where the held line ends
+    const xyze_pos_t &from = blend.pending ? blend.end : blend.start;
+    const xyz_pos_t &corner = from, &target = cart;
+    const xyz_pos_t d2 = target - corner;
+    const float len2 = d2.magnitude();
+
+    // Lines without any axis motion can't be blended
+    if (!len2) { blend_flush(); return blend_line(cart, fr_mm_s, extruder, 0); }
+
+    if (blend.pending) do {
+      if (blend.extruder != extruder) break;
+
+      const xyz_pos_t &held_start = blend.start;
+      const xyz_pos_t d1 = corner - held_start;
+      const float len1 = d1.magnitude();
+      if (!len1) break;
+
+      const xyz_float_t u1 = d1 / len1, u2 = d2 / len2;
+      float cos_phi = 0;
+      LOOP_NUM_AXES(i) cos_phi += u1[i] * u2[i];
+
+      // Skip straight lines and near-reversals
+      if (cos_phi > 0.9999f || cos_phi < -0.99f) break;
+
+      // Tangent length 'd' for the largest arc within the tolerance. Leave 10% for the chords.
+      const float cos_h = SQRT(0.5f * (1.0f + cos_phi)),  // cos(phi/2)
+                  sin_h = SQRT(0.5f * (1.0f - cos_phi)),  // sin(phi/2)
+                  tol = blend_tolerance * 0.9f;
+      float d = tol * sin_h / (1.0f - cos_h);
+      NOMORE(d, len1);
+      NOMORE(d, len2 * 0.5f);
+
+      const float radius = d * cos_h / sin_h,
+                  phi = 2.0f * ATAN2(sin_h, cos_h);
+
+      // Enough chords to keep each one within the other 10% of the tolerance
+      const float chord_phi = 2.0f * ACOS(1.0f - _MIN(1.0f, blend_tolerance * 0.1f / radius));
+      const uint8_t chords = chord_phi > 0 ? constrain(CEIL(phi / chord_phi), 1, 8) : 8;
+
+      const xyz_pos_t t1 = corner - u1 * d,
+                      t2 = corner + u2 * d,
+                      center = corner + (u2 - u1) * (radius / (2.0f * sin_h * cos_h)),
+                      v1 = t1 - center, v2 = t2 - center;
+
+      // Cut the held line short at the start of the arc
+      const float f1 = 1.0f - d / len1;
+      xyze_pos_t arc_start = blend.start;
+      arc_start = t1;
+      TERN_(HAS_EXTRUDERS, arc_start.e += (blend.end.e - blend.start.e) * f1);
+      blend.pending = false;
+      if (f1 > 0.0001f && !blend_line(arc_start, blend.fr_mm_s, extruder, blend.curve_radius)) return false;
+
+      // E moves in proportion along the arc
+      #if HAS_EXTRUDERS
+        const float e_start = arc_start.e, e_end = from.e + (cart.e - from.e) * (d / len2);
+      #endif
+
+      // Chords along the arc, interpolated from t1 to t2 about the center
+      const feedRate_t arc_fr_mm_s = _MIN(blend.fr_mm_s, fr_mm_s);
+      const float inv_sin_phi = 1.0f / sinf(phi);
+      xyze_pos_t p = arc_start;
+      for (uint8_t n = 1; n <= chords; ++n) {
+        const float t = float(n) / chords;
+        p = n < chords ? center + (v1 * sinf((1.0f - t) * phi) + v2 * sinf(t * phi)) * inv_sin_phi : t2;
+        TERN_(HAS_EXTRUDERS, p.e = e_start + (e_end - e_start) * t);
+        if (!blend_line(p, arc_fr_mm_s, extruder, radius)) return false;
+      }
+
+      // Hold back the rest of the new line, entering at the arc speed
+      blend.curve_radius = radius;
+      blend.end = cart;
+      blend.fr_mm_s = fr_mm_s;
+      blend.extruder = extruder;
+      blend.pending = true;
+      return true;
+
+    } while (0);
+
+    // No blend. Buffer the held line as-is and hold back the new one.
+    blend_flush();
+    if (!blend.valid) return false;
+    blend.curve_radius = 0;
+    blend.end = cart;
+    blend.fr_mm_s = fr_mm_s;
+    blend.extruder = extruder;
+    blend.pending = true;
+    return true;
+  }
+
+#endif // PATH_BLENDING
+
 #if ENABLED(DIRECT_STEPPING)
 
   void Planner::buffer_page(const page_idx_t page_idx, const uint8_t extruder, const uint16_t num_steps) {
@@ -3245,6 +3655,11 @@ bool Planner::buffer_line(const xyze_pos_t &cart, const_feedRate_t fr_mm_s
  * The provided ABCE position is in machine units.
  */
 void Planner::set_machine_position_mm(const abce_pos_t &abce) {
+  TERN_(SEGMENT_COALESCING, coalescer.flush());
+  #if ENABLED(PATH_BLENDING)
+    blend_flush();
+    blend.valid = false;
+  #endif
   TERN_(DISTINCT_E_FACTORS, last_extruder = active_extruder);
   TERN_(HAS_POSITION_FLOAT, position_float = abce);
   position.set(
@@ -3289,6 +3704,10 @@ void Planner::set_position_mm(const xyze_pos_t &xyze) {
   #else
     set_machine_position_mm(machine);
   #endif
+  #if ENABLED(PATH_BLENDING)
+    blend.start = xyze;
+    blend.valid = true;
+  #endif
 }
 
 #if HAS_EXTRUDERS
@@ -3300,6 +3719,12 @@ void Planner::set_position_mm(const xyze_pos_t &xyze) {
     const uint8_t axis_index = E_AXIS_N(active_extruder);
     TERN_(DISTINCT_E_FACTORS, last_extruder = active_extruder);
 
+    TERN_(SEGMENT_COALESCING, coalescer.flush());
+    #if ENABLED(PATH_BLENDING)
+      blend_flush();
+      blend.start.e = e;
+    #endif
+
     const float e_new = DIFF_TERN(FWRETRACT, e, fwretract.current_retract[active_extruder]);
     position.e = LROUND(settings.axis_steps_per_mm[axis_index] * e_new);
     TERN_(HAS_POSITION_FLOAT, position_float.e = e_new);
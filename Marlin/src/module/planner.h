@@ -116,6 +116,9 @@ enum BlockFlagBit {
 
   // Sync laser power from a queued block
   OPTARG(LASER_POWER_SYNC, BLOCK_BIT_LASER_PWR)
+
+  // An arc traced by Fixed-Time Motion
+  OPTARG(NATIVE_ARCS, BLOCK_BIT_ARC)
 };
 
 /**
@@ -145,6 +148,10 @@ typedef struct {
       #if ENABLED(LASER_POWER_SYNC)
         bool sync_laser_pwr:1;
       #endif
+
+      #if ENABLED(NATIVE_ARCS)
+        bool arc:1;
+      #endif
     };
   };
 
@@ -179,6 +186,30 @@ typedef struct {
 
 #endif
 
+#if ENABLED(NATIVE_ARCS)
+  // The path of an arc block, in the plane of axis_p and axis_q
+  typedef struct {
+    AxisEnum axis_p, axis_q;
+    float radius,                           // (mm)
+          start_angle,                      // (rad) Angle of the start point around the center
+          angular_travel;                   // (rad) Signed sweep, positive for counter-clockwise
+  } block_arc_t;
+#endif
+
+#if ENABLED(COMPACT_PLANNER_BLOCKS)
+  typedef uint16_t block_steps_t;
+  typedef xyze_uint_t abce_block_steps_t;
+  // Most steps a move may have before it's split, leaving room for backlash correction
+  #if ANY(IS_CORE, MARKFORGED_XY, MARKFORGED_YX)
+    #define BLOCK_SPLIT_STEPS 0x7800  // Motor steps may be the sum of two axes
+  #else
+    #define BLOCK_SPLIT_STEPS 0xF000
+  #endif
+#else
+  typedef uint32_t block_steps_t;
+  typedef abce_ulong_t abce_block_steps_t;
+#endif
+
 /**
  * struct block_t
  *
@@ -197,19 +228,9 @@ typedef struct PlannerBlock {
   volatile bool is_sync() { return flag.sync_position || is_fan_sync() || is_pwr_sync(); }
   volatile bool is_page() { return TERN0(DIRECT_STEPPING, flag.page); }
   volatile bool is_move() { return !(is_sync() || is_page()); }
+  volatile bool is_arc() { return TERN0(NATIVE_ARCS, flag.arc); }
 
-  // Fields used by the motion planner to manage acceleration
-  float nominal_speed,                      // The nominal speed for this block in (mm/sec)
-        entry_speed_sqr,                    // Entry speed at previous-current junction in (mm/sec)^2
-        max_entry_speed_sqr,                // Maximum allowable junction entry speed in (mm/sec)^2
-        millimeters,                        // The total travel of this block in mm
-        acceleration;                       // acceleration mm/sec^2
-
-  union {
-    abce_ulong_t steps;                     // Step count along each axis
-    abce_long_t position;                   // New position to force when this sync block is executed
-  };
-  uint32_t step_event_count;                // The number of step events required to complete this block
+  axis_bits_t direction_bits;               // The direction bit set for this block (refers to *_DIRECTION_BIT in config.h)
 
   #if HAS_MULTI_EXTRUDER
     uint8_t extruder;                       // The extruder to move (if E move)
@@ -217,53 +238,75 @@ typedef struct PlannerBlock {
     static constexpr uint8_t extruder = 0;
   #endif
 
-  #if ENABLED(MIXING_EXTRUDER)
-    mixer_comp_t b_color[MIXING_STEPPERS];  // Normalized color for the mixing steppers
+  #if ENABLED(LIN_ADVANCE)
+    uint8_t la_scaling;                     // Scale ISR frequency down and step frequency up by 2 ^ la_scaling
   #endif
 
-  // Settings for the trapezoid generator
-  uint32_t accelerate_until,                // The index of the step event on which to stop acceleration
-           decelerate_after;                // The index of the step event on which to start decelerating
+  #if HAS_FAN
+    uint8_t fan_speed[FAN_COUNT];
+  #endif
 
-  #if ENABLED(S_CURVE_ACCELERATION)
-    uint32_t cruise_rate,                   // The actual cruise rate to use, between end of the acceleration phase and start of deceleration phase
-             acceleration_time,             // Acceleration time and deceleration time in STEP timer counts
-             deceleration_time,
-             acceleration_time_inverse,     // Inverse of acceleration and deceleration periods, expressed as integer. Scale depends on CPU being used
-             deceleration_time_inverse;
-  #else
-    uint32_t acceleration_rate;             // The acceleration rate used for acceleration calculation
+  #if ENABLED(BARICUDA)
+    uint8_t valve_pressure, e_to_p_pressure;
   #endif
 
-  axis_bits_t direction_bits;               // The direction bit set for this block (refers to *_DIRECTION_BIT in config.h)
+  // Fields used by the motion planner to manage acceleration
+  float nominal_speed,                      // The nominal speed for this block in (mm/sec)
+        entry_speed_sqr,                    // Entry speed at previous-current junction in (mm/sec)^2
+        max_entry_speed_sqr,                // Maximum allowable junction entry speed in (mm/sec)^2
+        millimeters,                        // The total travel of this block in mm
+        acceleration;                       // acceleration mm/sec^2
 
-  // Advance extrusion
-  #if ENABLED(LIN_ADVANCE)
-    uint32_t la_advance_rate;               // The rate at which steps are added whilst accelerating
-    uint8_t  la_scaling;                    // Scale ISR frequency down and step frequency up by 2 ^ la_scaling
-    uint16_t max_adv_steps,                 // Max advance steps to get cruising speed pressure
-             final_adv_steps;               // Advance steps for exit speed pressure
+  #if ENABLED(MIXING_EXTRUDER)
+    mixer_comp_t b_color[MIXING_STEPPERS];  // Normalized color for the mixing steppers
   #endif
 
-  uint32_t nominal_rate,                    // The nominal step rate for this block in step_events/sec
-           initial_rate,                    // The jerk-adjusted step rate at start of block
-           final_rate,                      // The minimal rate at exit
-           acceleration_steps_per_s2;       // acceleration steps/sec^2
+  union {
+    abce_long_t position;                   // New position to force when this sync block is executed
+
+    // Stepper data, only used by move blocks
+    struct {
+      abce_block_steps_t steps;             // Step count along each axis
+      block_steps_t step_event_count,       // The number of step events required to complete this block
+
+      // Settings for the trapezoid generator
+                    accelerate_until,       // The index of the step event on which to stop acceleration
+                    decelerate_after;       // The index of the step event on which to start decelerating
+
+      #if ENABLED(S_CURVE_ACCELERATION)
+        uint32_t cruise_rate,               // The actual cruise rate to use, between end of the acceleration phase and start of deceleration phase
+                 acceleration_time,         // Acceleration time and deceleration time in STEP timer counts
+                 deceleration_time,
+                 acceleration_time_inverse, // Inverse of acceleration and deceleration periods, expressed as integer. Scale depends on CPU being used
+                 deceleration_time_inverse;
+      #else
+        uint32_t acceleration_rate;         // The acceleration rate used for acceleration calculation
+      #endif
+
+      // Advance extrusion
+      #if ENABLED(LIN_ADVANCE)
+        uint32_t la_advance_rate;           // The rate at which steps are added whilst accelerating
+        uint16_t max_adv_steps,             // Max advance steps to get cruising speed pressure
+                 final_adv_steps;           // Advance steps for exit speed pressure
+      #endif
+
+      uint32_t nominal_rate,                // The nominal step rate for this block in step_events/sec
+               initial_rate,                // The jerk-adjusted step rate at start of block
+               final_rate,                  // The minimal rate at exit
+               acceleration_steps_per_s2;   // acceleration steps/sec^2
+    };
+  };
 
   #if ENABLED(DIRECT_STEPPING)
     page_idx_t page_idx;                    // Page index used for direct stepping
   #endif
 
-  #if HAS_CUTTER
-    cutter_power_t cutter_power;            // Power level for Spindle, Laser, etc.
+  #if ENABLED(NATIVE_ARCS)
+    block_arc_t arc;                        // Arc path, if flag.arc is set
   #endif
 
-  #if HAS_FAN
-    uint8_t fan_speed[FAN_COUNT];
-  #endif
-
-  #if ENABLED(BARICUDA)
-    uint8_t valve_pressure, e_to_p_pressure;
+  #if HAS_CUTTER
+    cutter_power_t cutter_power;            // Power level for Spindle, Laser, etc.
   #endif
 
   #if HAS_WIRED_LCD
@@ -317,6 +360,13 @@ typedef struct {
             min_travel_feedrate_mm_s;           // (mm/s) M205 T - Minimum travel feedrate
 } planner_settings_t;
 
+#if ENABLED(NONLINEAR_EXTRUSION)
+  typedef struct {
+    float A,                                    // (per mm^3/s) M592 A - Linear flow coefficient
+          B;                                    // (per (mm^3/s)^2) M592 B - Quadratic flow coefficient
+  } nonlinear_extrusion_t;
+#endif
+
 #if ENABLED(IMPROVE_HOMING_RELIABILITY)
   struct motion_state_t {
     TERN(DELTA, xyz_ulong_t, xy_ulong_t) acceleration;
@@ -350,8 +400,10 @@ typedef struct {
   typedef IF<(BLOCK_BUFFER_SIZE > 64), uint16_t, uint8_t>::type last_move_t;
 #endif
 
-#if ENABLED(ARC_SUPPORT)
+#if ANY(ARC_SUPPORT, PATH_BLENDING, BEZIER_CURVE_SUPPORT)
   #define HINTS_CURVE_RADIUS
+#endif
+#if ENABLED(ARC_SUPPORT)
   #define HINTS_SAFE_EXIT_SPEED
 #endif
 
@@ -370,6 +422,9 @@ struct PlannerHints {
                                       // i.e., at or below the exit speed of the segment that the planner
                                       // would calculate if it knew the as-yet-unbuffered path
   #endif
+  #if ENABLED(NATIVE_ARCS)
+    const block_arc_t *arc = nullptr; // Queue the move as an arc along this path
+  #endif
 
   PlannerHints(const_float_t mm=0.0f) : millimeters(mm) {}
 };
@@ -423,6 +478,13 @@ class Planner {
     #if ENABLED(VOLUMETRIC_EXTRUDER_LIMIT)
       static float volumetric_extruder_limit[EXTRUDERS],          // Maximum mm^3/sec the extruder can handle
                    volumetric_extruder_feedrate_limit[EXTRUDERS]; // Feedrate limit (mm/s) calculated from volume limit
+      #if ENABLED(VOLUMETRIC_LIMIT_BY_TEMP)
+        static float volumetric_extruder_limit_scale[EXTRUDERS];  // Melt capacity at the current temperature and heater power
+      #endif
+    #endif
+
+    #if ENABLED(NONLINEAR_EXTRUSION)
+      static nonlinear_extrusion_t nonlinear_extrusion[EXTRUDERS]; // E multiplier coefficients by volumetric flow
     #endif
 
     static planner_settings_t settings;
@@ -441,6 +503,20 @@ class Planner {
       #endif
     #endif
 
+    #if ENABLED(PATH_BLENDING)
+      static float blend_tolerance;                   // (mm) G64 P - Allowed corner deviation. 0 for exact path.
+    #endif
+
+    #if ENABLED(PLANNER_KERNEL_STATS)
+      typedef struct {
+        uint32_t blocks,                              // Blocks queued
+                 reverse, forward,                    // Reverse and forward pass kernel calls
+                 scanned,                             // Blocks scanned for trapezoid changes
+                 trapezoid;                           // Trapezoids calculated
+      } kernel_stats_t;
+      static kernel_stats_t kernel_stats;             // M495 - Planner workload
+    #endif
+
     #if HAS_CLASSIC_JERK
       // (mm/s^2) M205 XYZ(E) - The largest speed change requiring no acceleration.
       static TERN(HAS_LINEAR_E_JERK, xyz_pos_t, xyze_pos_t) max_jerk;
@@ -575,6 +651,13 @@ class Planner {
         refresh_e_factor(e);
       }
 
+      #if ENABLED(COMPACT_PLANNER_BLOCKS)
+        // The most E steps a block may get per requested E step
+        FORCE_INLINE static float max_e_factor(const uint8_t e) {
+          return e_factor[e] * TERN1(NONLINEAR_EXTRUSION, float(NONLINEAR_EXTRUSION_MAX));
+        }
+      #endif
+
     #endif
 
     // Manage fans, paste pressure, etc.
@@ -614,6 +697,10 @@ class Planner {
         // Update pre calculated extruder feedrate limits based on volumetric values
         static void calculate_volumetric_extruder_limit(const uint8_t e);
         static void calculate_volumetric_extruder_limits();
+        #if ENABLED(VOLUMETRIC_LIMIT_BY_TEMP)
+          // Scale the limits with new temperature readings
+          static void update_volumetric_extruder_limits();
+        #endif
       #endif
 
       FORCE_INLINE static void set_filament_size(const uint8_t e, const_float_t v) {
@@ -626,6 +713,14 @@ class Planner {
 
     #endif
 
+    #if ENABLED(NONLINEAR_EXTRUSION)
+      // E multiplier for a move that asks for the given flow (mm^3/s)
+      static float nonlinear_extrusion_factor(const uint8_t e, const_float_t flow) {
+        const nonlinear_extrusion_t &ne = nonlinear_extrusion[e];
+        return constrain(1.0f + (ne.A + ne.B * flow) * flow, 1.0f / (NONLINEAR_EXTRUSION_MAX), NONLINEAR_EXTRUSION_MAX);
+      }
+    #endif
+
     #if ENABLED(VOLUMETRIC_EXTRUDER_LIMIT)
       FORCE_INLINE static void set_volumetric_extruder_limit(const uint8_t e, const_float_t v) {
         volumetric_extruder_limit[e] = v;
@@ -860,6 +955,35 @@ class Planner {
       , const PlannerHints &hints=PlannerHints()
     );
 
+    #if ENABLED(PATH_BLENDING)
+      // Buffer the line held back for blending, if any
+      static void blend_flush();
+
+      // Don't hold a line back while the planner is running dry. Called from idle().
+      static void blend_task() { if (blend.pending && movesplanned() < 2) blend_flush(); }
+
+    private:
+
+      typedef struct {
+        bool pending,       // A line is held back to blend with the next one
+             valid;         // 'start' is where the next line will start
+        xyze_pos_t start,   // Cartesian start of the held (or next) line
+                   end;     // Cartesian end of the held line
+        feedRate_t fr_mm_s;
+        uint8_t extruder;
+        float curve_radius; // Radius of the blend leading into the held line
+      } blend_state_t;
+
+      static blend_state_t blend;
+
+      // Buffer a line (without blending) and update the blend start
+      static bool blend_line(const xyze_pos_t &cart, const_feedRate_t fr_mm_s, const uint8_t extruder, const_float_t curve_radius);
+
+      static bool _buffer_line(const xyze_pos_t &cart, const_feedRate_t fr_mm_s, const uint8_t extruder, const PlannerHints &hints);
+
+    public:
+    #endif
+
     #if ENABLED(DIRECT_STEPPING)
       static void buffer_page(const page_idx_t page_idx, const uint8_t extruder, const uint16_t num_steps);
     #endif
@@ -930,11 +1054,7 @@ class Planner {
     static float triggered_position_mm(const AxisEnum axis);
 
     // Blocks are queued, or we're running out moves, or the closed loop controller is waiting
-    static bool busy() {
-      return (has_blocks_queued() || cleaning_buffer_counter
-          || TERN0(EXTERNAL_CLOSED_LOOP_CONTROLLER, CLOSED_LOOP_WAITING())
-      );
-    }
+    static bool busy();
 
     // Block until all buffered steps are executed / cleaned
     static void synchronize();
@@ -1014,9 +1134,33 @@ class Planner {
      * 'distance'.
      */
     static float max_allowable_speed_sqr(const_float_t accel, const_float_t target_velocity_sqr, const_float_t distance) {
-      return target_velocity_sqr - 2 * accel * distance;
+      #if ENABLED(S_CURVE_JERK_LIMIT)
+        return s_curve_speed_sqr(-accel, target_velocity_sqr, distance);
+      #else
+        return target_velocity_sqr - 2 * accel * distance;
+      #endif
     }
 
+    #if ENABLED(S_CURVE_JERK_LIMIT)
+      /**
+       * The Stepper ISR ramps the speed along a Bézier curve in the time a trapezoid
+       * with acceleration 'a' would take. The curve peaks at 15/8 a and its jerk at
+       * 10/√3 a²/Δv. Get the 'a' that keeps a ramp by 'dv' within the given maximum
+       * acceleration and jerk. Any units will do, as long as they're all the same.
+       */
+      static float s_curve_accel(const_float_t accel, const_float_t jerk, const_float_t dv) {
+        return _MIN(accel * (8.0f / 15.0f), SQRT(jerk * dv * 0.17320508f));
+      }
+
+      // Distance needed to ramp from one speed to another within the acceleration and jerk
+      static float s_curve_distance(const_float_t v1, const_float_t v2, const_float_t accel, const_float_t jerk) {
+        const float dv = ABS(v2 - v1);
+        return dv > 0 ? (v1 + v2) * dv / (2 * s_curve_accel(accel, jerk, dv)) : 0;
+      }
+
+      static float s_curve_speed_sqr(const_float_t accel, const_float_t target_velocity_sqr, const_float_t distance);
+    #endif
+
     #if EITHER(S_CURVE_ACCELERATION, LIN_ADVANCE)
       /**
        * Calculate the speed reached given initial speed, acceleration and distance
@@ -1034,7 +1178,7 @@ class Planner {
     static void reverse_pass(TERN_(ARC_SUPPORT, const_float_t safe_exit_speed_sqr));
     static void forward_pass();
 
-    static void recalculate_trapezoids(TERN_(ARC_SUPPORT, const_float_t safe_exit_speed_sqr));
+    static void recalculate_trapezoids(const uint8_t start_index OPTARG(ARC_SUPPORT, const_float_t safe_exit_speed_sqr));
 
     static void recalculate(TERN_(ARC_SUPPORT, const_float_t safe_exit_speed_sqr));
 
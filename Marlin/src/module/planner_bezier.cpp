@@ -37,10 +37,14 @@
 #include "../MarlinCore.h"
 #include "../gcode/queue.h"
 
-// See the meaning in the documentation of cubic_b_spline().
-#define MIN_STEP 0.002f
-#define MAX_STEP 0.1f
-#define SIGMA 0.1f
+#if ENABLED(MARLIN_TEST_BUILD)
+  #include "../tests/test_helpers.h"
+#endif
+
+#ifndef BEZIER_MAX_DEVIATION
+  #define BEZIER_MAX_DEVIATION 0.05f  // (mm) Distance allowed between the curve and its segments
+#endif
+#define BEZIER_MIN_STEP 0.0005f       // Smallest step of 't', to bound the number of segments
 
 // Compute the linear interpolation between two real numbers.
 static inline float interp(const_float_t a, const_float_t b, const_float_t t) { return (1 - t) * a + t * b; }
@@ -60,50 +64,61 @@ static inline float eval_bezier(const_float_t a, const_float_t b, const_float_t
   return interp(iabc, ibcd, t);
 }
 
-/**
- * We approximate Euclidean distance with the sum of the coordinates
- * offset (so-called "norm 1"), which is quicker to compute.
- */
-static inline float dist1(const_float_t x1, const_float_t y1, const_float_t x2, const_float_t y2) { return ABS(x1 - x2) + ABS(y1 - y2); }
+static inline xy_pos_t eval_bezier(const xy_pos_t (&p)[4], const_float_t t) {
+  return { eval_bezier(p[0].x, p[1].x, p[2].x, p[3].x, t), eval_bezier(p[0].y, p[1].y, p[2].y, p[3].y, t) };
+}
+
+// First derivative (velocity) of the curve at t
+static inline xy_float_t bezier_d1(const xy_pos_t (&p)[4], const_float_t t) {
+  const float u = 1 - t;
+  return ((p[1] - p[0]) * (u * u) + (p[2] - p[1]) * (2 * u * t) + (p[3] - p[2]) * (t * t)) * 3;
+}
+
+// Second derivative (acceleration) of the curve at t. It's linear in t.
+static inline xy_float_t bezier_d2(const xy_pos_t (&p)[4], const_float_t t) {
+  return ((p[0] - p[1] * 2 + p[2]) * (1 - t) + (p[1] - p[2] * 2 + p[3]) * t) * 6;
+}
 
 /**
- * The algorithm for computing the step is loosely based on the one in Kig
- * (See https://sources.debian.net/src/kig/4:15.08.3-1/misc/kigpainter.cpp/#L759)
- * However, we do not use the stack.
- *
- * The algorithm goes as it follows: the parameters t runs from 0.0 to
- * 1.0 describing the curve, which is evaluated by eval_bezier(). At
- * each iteration we have to choose a step, i.e., the increment of the
- * t variable. By default the step of the previous iteration is taken,
- * and then it is enlarged or reduced depending on how straight the
- * curve locally is. The step is always clamped between MIN_STEP/2 and
- * 2*MAX_STEP. MAX_STEP is taken at the first iteration.
+ * Get the end of the next segment, starting from t.
  *
- * For some t, the step value is considered acceptable if the curve in
- * the interval [t, t+step] is sufficiently straight, i.e.,
- * sufficiently close to linear interpolation. In practice the
- * following test is performed: the distance between eval_bezier(...,
- * t+step/2) is evaluated and compared with 0.5*(eval_bezier(...,
- * t)+eval_bezier(..., t+step)). If it is smaller than SIGMA, then the
- * step value is considered acceptable, otherwise it is not. The code
- * seeks to find the larger step value which is considered acceptable.
+ * A segment from t0 to t1 can't stray from the curve by more than
+ * (t1 - t0)² / 8 times the largest |B''| between t0 and t1. Since B''
+ * is linear in t, |B''| is largest at one end, so the step is sized for
+ * the curvature at t and then shortened if it's tighter at the far end.
+ * Gentle curves get long segments and tight bends get short ones, and
+ * every segment stays within BEZIER_MAX_DEVIATION of the curve.
  *
- * At every iteration the recorded step value is considered and then
- * iteratively halved until it becomes acceptable. If it was already
- * acceptable in the beginning (i.e., no halving were done), then
- * maybe it was necessary to enlarge it; then it is iteratively
- * doubled while it remains acceptable. The last acceptable value
- * found is taken, provided that it is between MIN_STEP and MAX_STEP
- * and does not bring t over 1.0.
+ * A short remainder at the end of the curve is shared with the segment
+ * before it, so the last segment isn't a sliver.
+ */
+static float bezier_next_t(const xy_pos_t (&p)[4], const_float_t t) {
+  constexpr float max_err8 = 8 * (BEZIER_MAX_DEVIATION);
+  const float d2 = bezier_d2(p, t).magnitude();
+  float step = d2 > max_err8 ? SQRT(max_err8 / d2) : 1.0f;
+  const float d2_end = bezier_d2(p, _MIN(t + step, 1.0f)).magnitude();
+  if (d2_end > d2) step = d2_end > max_err8 ? SQRT(max_err8 / d2_end) : 1.0f;
+  NOLESS(step, BEZIER_MIN_STEP);
+
+  const float rest = 1.0f - t;
+  return rest <= step ? 1.0f : rest < 2 * step ? t + 0.5f * rest : t + step;
+}
+
+// Radius of curvature at t, or 0 if the path is straight or stopped there
+static float bezier_radius(const xy_pos_t (&p)[4], const_float_t t) {
+  const xy_float_t d1 = bezier_d1(p, t), d2 = bezier_d2(p, t);
+  const float cross = ABS(d1.x * d2.y - d1.y * d2.x), speed = d1.magnitude();
+  return cross > 0.0001f ? speed * speed * speed / cross : 0.0f;
+}
+
+/**
+ * Buffer a cubic Bézier curve in XY as a series of lines, with the other
+ * axes moving linearly. The segments are sized by bezier_next_t() so they
+ * follow the curve within BEZIER_MAX_DEVIATION.
  *
- * Caveat: this algorithm is not perfect, since it can happen that a
- * step is considered acceptable even when the curve is not linear at
- * all in the interval [t, t+step] (but its mid point coincides "by
- * chance" with the midpoint according to the parametrization). This
- * kind of glitches can be eliminated with proper first derivative
- * estimates; however, given the improbability of such configurations,
- * the mitigation offered by MIN_STEP and the small computational
- * power available on Arduino, I think it is not wise to implement it.
+ * Each segment after the first passes the radius of curvature at its start
+ * to the planner so the junctions between segments are limited by the
+ * centripetal acceleration of the curve instead of by junction deviation.
  */
 void cubic_b_spline(
   const xyze_pos_t &position,       // current position
@@ -113,11 +128,9 @@ void cubic_b_spline(
   const uint8_t extruder
 ) {
   // Absolute first and second control points are recovered.
-  const xy_pos_t first = position + offsets[0], second = target + offsets[1];
+  const xy_pos_t ctrl[4] = { position, position + offsets[0], target + offsets[1], target };
 
-  xyze_pos_t bez_target;
-  bez_target.set(position.x, position.y);
-  float step = MAX_STEP;
+  xyze_pos_t bez_target = position;
 
   millis_t next_idle_ms = millis() + 200UL;
 
@@ -133,61 +146,17 @@ void cubic_b_spline(
       idle();
     }
 
-    // First try to reduce the step in order to make it sufficiently
-    // close to a linear interpolation.
-    bool did_reduce = false;
-    float new_t = t + step;
-    NOMORE(new_t, 1);
-    float new_pos0 = eval_bezier(position.x, first.x, second.x, target.x, new_t),
-          new_pos1 = eval_bezier(position.y, first.y, second.y, target.y, new_t);
-    for (;;) {
-      if (new_t - t < (MIN_STEP)) break;
-      const float candidate_t = 0.5f * (t + new_t),
-                  candidate_pos0 = eval_bezier(position.x, first.x, second.x, target.x, candidate_t),
-                  candidate_pos1 = eval_bezier(position.y, first.y, second.y, target.y, candidate_t),
-                  interp_pos0 = 0.5f * (bez_target.x + new_pos0),
-                  interp_pos1 = 0.5f * (bez_target.y + new_pos1);
-      if (dist1(candidate_pos0, candidate_pos1, interp_pos0, interp_pos1) <= (SIGMA)) break;
-      new_t = candidate_t;
-      new_pos0 = candidate_pos0;
-      new_pos1 = candidate_pos1;
-      did_reduce = true;
-    }
+    // The junction at the start of each segment after the first is on the curve
+    if (t > 0) hints.curve_radius = bezier_radius(ctrl, t);
 
-    // If we did not reduce the step, maybe we should enlarge it.
-    if (!did_reduce) for (;;) {
-      if (new_t - t > MAX_STEP) break;
-      const float candidate_t = t + 2 * (new_t - t);
-      if (candidate_t >= 1) break;
-      const float candidate_pos0 = eval_bezier(position.x, first.x, second.x, target.x, candidate_t),
-                  candidate_pos1 = eval_bezier(position.y, first.y, second.y, target.y, candidate_t),
-                  interp_pos0 = 0.5f * (bez_target.x + candidate_pos0),
-                  interp_pos1 = 0.5f * (bez_target.y + candidate_pos1);
-      if (dist1(new_pos0, new_pos1, interp_pos0, interp_pos1) > (SIGMA)) break;
-      new_t = candidate_t;
-      new_pos0 = candidate_pos0;
-      new_pos1 = candidate_pos1;
-    }
-
-    // Check some postcondition; they are disabled in the actual
-    // Marlin build, but if you test the same code on a computer you
-    // may want to check they are respect.
-    /*
-      assert(new_t <= 1.0);
-      if (new_t < 1.0) {
-        assert(new_t - t >= (MIN_STEP) / 2.0);
-        assert(new_t - t <= (MAX_STEP) * 2.0);
-      }
-    */
-
-    hints.millimeters = new_t - t;
-    t = new_t;
+    t = bezier_next_t(ctrl, t);
 
     // Compute and send new position
+    const xy_pos_t new_pos = eval_bezier(ctrl, t);
     xyze_pos_t new_bez = LOGICAL_AXIS_ARRAY(
       interp(position.e, target.e, t),  // FIXME. Wrong, since t is not linear in the distance.
-      new_pos0,
-      new_pos1,
+      new_pos.x,
+      new_pos.y,
       interp(position.z, target.z, t),  // FIXME. Wrong, since t is not linear in the distance.
       interp(position.i, target.i, t),  // FIXME. Wrong, since t is not linear in the distance.
       interp(position.j, target.j, t),  // FIXME. Wrong, since t is not linear in the distance.
@@ -197,6 +166,7 @@ void cubic_b_spline(
       interp(position.w, target.w, t)   // FIXME. Wrong, since t is not linear in the distance.
     );
     apply_motion_limits(new_bez);
+    hints.millimeters = xyz_pos_t(new_bez - bez_target).magnitude();
     bez_target = new_bez;
 
     #if HAS_LEVELING && !PLANNER_LEVELING
@@ -211,4 +181,100 @@ void cubic_b_spline(
   }
 }
 
+#if ENABLED(MARLIN_TEST_BUILD)
+
+  /**
+   * The midpoint test G5 used before, for comparison. Each step starts at
+   * 0.1 and is halved until the middle of the curve is within 'sigma'
+   * (norm 1) of the middle of the chord, or doubled while it stays within.
+   */
+  static float bezier_midpoint_next_t(const xy_pos_t (&p)[4], const_float_t t, const_float_t sigma) {
+    constexpr float min_step = 0.002f, max_step = 0.1f;
+    const xy_pos_t a = eval_bezier(p, t);
+    auto straight = [&](const_float_t t1) {
+      const xy_pos_t m = eval_bezier(p, 0.5f * (t + t1)) - (a + eval_bezier(p, t1)) * 0.5f;
+      return ABS(m.x) + ABS(m.y) <= sigma;
+    };
+    float new_t = _MIN(t + max_step, 1.0f);
+    bool did_reduce = false;
+    while (new_t - t >= min_step && !straight(new_t)) { new_t = 0.5f * (t + new_t); did_reduce = true; }
+    if (!did_reduce) for (;;) {
+      if (new_t - t > max_step) break;
+      const float candidate_t = t + 2 * (new_t - t);
+      if (candidate_t >= 1 || !straight(candidate_t)) break;
+      new_t = candidate_t;
+    }
+    return new_t;
+  }
+
+  // Count the segments 'next_t' cuts the curve into. Raise 'worst' to the farthest
+  // they stray from it, measured at many points along each segment.
+  template<typename F>
+  static uint16_t bezier_segments(const xy_pos_t (&p)[4], F next_t, float &worst) {
+    uint16_t segments = 0;
+    for (float t = 0; t < 1;) {
+      const float t1 = next_t(t);
+      const xy_pos_t a = eval_bezier(p, t), b = eval_bezier(p, t1), ab = b - a;
+      const float len = ab.magnitude();
+      for (uint8_t i = 1; i < 32; ++i) {
+        const xy_pos_t q = eval_bezier(p, t + (t1 - t) * i / 32) - a;
+        NOLESS(worst, len ? ABS(ab.x * q.y - ab.y * q.x) / len : q.magnitude());
+      }
+      segments++;
+      t = t1;
+    }
+    return segments;
+  }
+
+  /**
+   * Segment a few sample curves with bezier_next_t() and with the old
+   * midpoint test, at the same max chord error. The midpoint test's SIGMA
+   * is lowered until none of its segments strays more than
+   * BEZIER_MAX_DEVIATION, then the segment counts are compared.
+   */
+  void test_bezier_segments() {
+    static const xy_pos_t curves[][4] PROGMEM = {
+      { {  0,  0 }, { 10,  0 }, { 20, 10 }, { 30, 10 } },   // Gentle S-bend
+      { {  0,  0 }, { 30,  0 }, { 30, 30 }, {  0, 30 } },   // Tight U-turn
+      { {  0,  0 }, { 50, 20 }, {-20, 20 }, { 30,  0 } },   // Loop with a cusp-like bend
+      { {  0,  0 }, { 40,  1 }, { 80, -1 }, {120,  0 } },   // Nearly straight
+      { {  0,  0 }, {  2,  2 }, {  4,  0 }, {  6,  2 } }    // Small wiggle
+    };
+    constexpr uint8_t curve_count = COUNT(curves);
+    xy_pos_t p[curve_count][4];
+    memcpy_P(p, curves, sizeof(p));
+
+    // Chord error segments
+    uint16_t segments[curve_count], total = 0;
+    float worst = 0;
+    LOOP_L_N(c, curve_count) {
+      segments[c] = bezier_segments(p[c], [&](const_float_t t) { return bezier_next_t(p[c], t); }, worst);
+      total += segments[c];
+    }
+
+    // Midpoint test, with the largest SIGMA (in steps of 10%) that meets the same max chord error
+    uint16_t mid_segments[curve_count], mid_total;
+    float sigma = 2 * (BEZIER_MAX_DEVIATION), mid_worst;
+    for (uint8_t tries = 0; tries < 50; ++tries, sigma *= 0.9f) {
+      mid_total = 0;
+      mid_worst = 0;
+      LOOP_L_N(c, curve_count) {
+        mid_segments[c] = bezier_segments(p[c], [&](const_float_t t) { return bezier_midpoint_next_t(p[c], t, sigma); }, mid_worst);
+        mid_total += mid_segments[c];
+      }
+      if (mid_worst <= BEZIER_MAX_DEVIATION) break;
+    }
+
+    SERIAL_ECHOPGM("G5 segments per curve, chord error / midpoint test (SIGMA ");
+    SERIAL_ECHO_F(sigma, 4);
+    SERIAL_ECHOPGM("):");
+    LOOP_L_N(c, curve_count) SERIAL_ECHOPGM(" ", segments[c], "/", mid_segments[c]);
+    SERIAL_ECHOLNPGM(" total ", total, "/", mid_total);
+    test_max_error(F("G5 chord error segments, max deviation"), worst, BEZIER_MAX_DEVIATION, F("mm"));
+    test_max_error(F("G5 midpoint test segments, max deviation"), mid_worst, BEZIER_MAX_DEVIATION, F("mm"));
+    test_result(F("G5 chord error segments no more than midpoint test"), total <= mid_total);
+  }
+
+#endif
+
 #endif // BEZIER_CURVE_SUPPORT
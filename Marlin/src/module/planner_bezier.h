@@ -36,3 +36,7 @@ void cubic_b_spline(
   const_feedRate_t scaled_fr_mm_s,  // mm/s scaled by feedrate %
   const uint8_t extruder
 );
+
+#if ENABLED(MARLIN_TEST_BUILD)
+  void test_bezier_segments();
+#endif
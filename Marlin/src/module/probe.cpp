@@ -100,6 +100,10 @@
   #include "../lcd/e3v2/proui/dwin.h"
 #endif
 
+#if ENABLED(FT_MOTION)
+  #include "ft_motion.h"
+#endif
+
 #define DEBUG_OUT ENABLED(DEBUG_LEVELING_FEATURE)
 #include "../core/debug_out.h"
 
@@ -852,6 +856,9 @@ float Probe::run_z_probe(const bool sanity_check/*=true*/) {
 float Probe::probe_at_point(const_float_t rx, const_float_t ry, const ProbePtRaise raise_after/*=PROBE_PT_NONE*/, const uint8_t verbose_level/*=0*/, const bool probe_relative/*=true*/, const bool sanity_check/*=true*/) {
   DEBUG_SECTION(log_probe, "Probe::probe_at_point", DEBUGGING(LEVELING));
 
+  // The probe is only checked by the trapezoid generator
+  TERN_(FT_MOTION, FTMotionDisableInScope FT_Disabler);
+
   if (DEBUGGING(LEVELING)) {
     DEBUG_ECHOLNPGM(
       "...(", LOGICAL_X_POSITION(rx), ", ", LOGICAL_Y_POSITION(ry),
@@ -882,7 +889,10 @@ float Probe::probe_at_point(const_float_t rx, const_float_t ry, const ProbePtRai
   // Move the probe to the starting XYZ
   do_blocking_move_to(npos, feedRate_t(XY_PROBE_FEEDRATE_MM_S));
 
-  TERN_(BD_SENSOR, return bdl.read());
+  #if ENABLED(BD_SENSOR)
+    // A flying scan stores bed heights, so report the same here. Otherwise report the distance.
+    return TERN_(BD_SENSOR_FLYING_SCAN, current_position.z -) bdl.read();
+  #endif
 
   float measured_z = NAN;
   if (!deploy()) {
@@ -32,11 +32,19 @@
 #include "motion.h"
 #include "planner.h"
 
+#include "../libs/fast_trig.h"
+
+#if ENABLED(MARLIN_TEST_BUILD)
+  #include "../tests/test_helpers.h"
+#endif
+
 #if ENABLED(AXEL_TPARA)
   #include "endstops.h"
   #include "../MarlinCore.h"
 #endif
 
+typedef TERN(SCARA_FAST_TRIG, fast_trig, float_trig) ik_trig;
+
 float segments_per_second = TERN(AXEL_TPARA, TPARA_SEGMENTS_PER_SECOND, SCARA_SEGMENTS_PER_SECOND);
 
 #if EITHER(MORGAN_SCARA, MP_SCARA)
@@ -99,7 +107,8 @@ float segments_per_second = TERN(AXEL_TPARA, TPARA_SEGMENTS_PER_SECOND, SCARA_SE
    * Maths and first version by QHARLEY.
    * Integrated into Marlin and slightly restructured by Joachim Cerny.
    */
-  void inverse_kinematics(const xyz_pos_t &raw) {
+  template <class TRIG>
+  static void _inverse_kinematics(const xyz_pos_t &raw) {
     float C2, S2, SK1, SK2, THETA, PSI;
 
     // Translate SCARA to standard XY with scaling factor
@@ -122,10 +131,10 @@ float segments_per_second = TERN(AXEL_TPARA, TPARA_SEGMENTS_PER_SECOND, SCARA_SE
     SK2 = L2 * S2;
 
     // Angle of Arm1 is the difference between Center-to-End angle and the Center-to-Elbow
-    THETA = ATAN2(SK1, SK2) - ATAN2(spos.x, spos.y);
+    THETA = TRIG::atan2(SK1, SK2) - TRIG::atan2(spos.x, spos.y);
 
     // Angle of Arm2
-    PSI = ATAN2(S2, C2);
+    PSI = TRIG::atan2(S2, C2);
 
     delta.set(DEGREES(THETA), DEGREES(SUM_TERN(MORGAN_SCARA, PSI, THETA)), raw.z);
 
@@ -161,11 +170,12 @@ float segments_per_second = TERN(AXEL_TPARA, TPARA_SEGMENTS_PER_SECOND, SCARA_SE
     }
   }
 
-  void inverse_kinematics(const xyz_pos_t &raw) {
+  template <class TRIG>
+  static void _inverse_kinematics(const xyz_pos_t &raw) {
     const float x = raw.x, y = raw.y, c = HYPOT(x, y),
-                THETA3 = ATAN2(y, x),
-                THETA1 = THETA3 + ACOS((sq(c) + sq(L1) - sq(L2)) / (2.0f * c * L1)),
-                THETA2 = THETA3 - ACOS((sq(c) + sq(L2) - sq(L1)) / (2.0f * c * L2));
+                THETA3 = TRIG::atan2(y, x),
+                THETA1 = THETA3 + TRIG::acos((sq(c) + sq(L1) - sq(L2)) / (2.0f * c * L1)),
+                THETA2 = THETA3 - TRIG::acos((sq(c) + sq(L2) - sq(L1)) / (2.0f * c * L2));
 
     delta.set(DEGREES(THETA1), DEGREES(THETA2), raw.z);
 
@@ -259,7 +269,8 @@ float segments_per_second = TERN(AXEL_TPARA, TPARA_SEGMENTS_PER_SECOND, SCARA_SE
     sync_plan_position();
   }
 
-  void inverse_kinematics(const xyz_pos_t &raw) {
+  template <class TRIG>
+  static void _inverse_kinematics(const xyz_pos_t &raw) {
     const xyz_pos_t spos = raw - robot_offset;
 
     const float RXY = SQRT(HYPOT2(spos.x, spos.y)),
@@ -274,15 +285,15 @@ float segments_per_second = TERN(AXEL_TPARA, TPARA_SEGMENTS_PER_SECOND, SCARA_SE
                 K2 = L2 * SG,
 
                 // Angle of Body Joint
-                THETA = ATAN2(spos.y, spos.x),
+                THETA = TRIG::atan2(spos.y, spos.x),
 
                 // Angle of Elbow Joint
                 //GAMMA = ACOS(CG),
-                GAMMA = ATAN2(SG, CG), // Method 2
+                GAMMA = TRIG::atan2(SG, CG), // Method 2
 
                 // Angle of Shoulder Joint, elevation angle measured from horizontal (r+)
                 //PHI = asin(spos.z/RHO) + asin(L2 * sin(GAMMA) / RHO),
-                PHI = ATAN2(spos.z, RXY) + ATAN2(K2, K1),   // Method 2
+                PHI = TRIG::atan2(spos.z, RXY) + TRIG::atan2(K2, K1),   // Method 2
 
                 // Elbow motor angle measured from horizontal, same frame as shoulder  (r+)
                 PSI = PHI + GAMMA;
@@ -294,6 +305,104 @@ float segments_per_second = TERN(AXEL_TPARA, TPARA_SEGMENTS_PER_SECOND, SCARA_SE
 
 #endif
 
+void inverse_kinematics(const xyz_pos_t &raw) { _inverse_kinematics<ik_trig>(raw); }
+
+#if ENABLED(MARLIN_TEST_BUILD)
+
+  /**
+   * Run the inverse kinematics with library and fast trig over the reach
+   * of the arm. Report evaluations per second for each, and check the
+   * largest distance between the arm end positions the two sets of angles
+   * give. The polynomials are good to 1.8e-6 rad, which moves the arm end
+   * by well under 2 microns.
+   */
+  void test_scara_ik() {
+    constexpr uint16_t points = 1024;
+
+    // Arm end positions on rings and spokes across the reach of the arm
+    auto test_point = [](const uint16_t i) -> xyz_pos_t {
+      const float rmin = ABS(L1 - L2) + 10, rmax = L1 + L2 - 10,
+                  rho = rmin + (rmax - rmin) * (i % 16) / 15.0f,
+                  angle = RADIANS((i / 16) * (360.0f / (points / 16)));
+      #if ENABLED(AXEL_TPARA)
+        // Raise the point so the vertical solution stays well conditioned
+        const float r = rho * 0.894f;
+        return robot_offset + xyz_pos_t({ r * cos(angle), r * sin(angle), rho * 0.447f });
+      #else
+        return xyz_pos_t({ TERN(MORGAN_SCARA, scara_offset.x, 0) + rho * cos(angle), TERN(MORGAN_SCARA, scara_offset.y, 0) + rho * sin(angle), 0 });
+      #endif
+    };
+
+    // Arm end position for the angles in 'delta'
+    auto arm_end = []() -> xyz_pos_t {
+      #if ENABLED(AXEL_TPARA)
+        forward_kinematics(delta.a, delta.b, delta.c);
+        return cartes;
+      #else
+        forward_kinematics(delta.a, delta.b);
+        return xyz_pos_t({ cartes.x, cartes.y, 0 });
+      #endif
+    };
+
+    auto rate = [&test_point](void (*ik)(const xyz_pos_t&)) {
+      return test_calls_per_second([&](const uint32_t i) { ik(test_point(i % points)); });
+    };
+
+    float worst = 0;
+    for (uint16_t i = 0; i < points; ++i) {
+      const xyz_pos_t p = test_point(i);
+      _inverse_kinematics<float_trig>(p); const xyz_pos_t ref = arm_end();
+      _inverse_kinematics<fast_trig>(p);  const xyz_pos_t fast = arm_end();
+      NOLESS(worst, (fast - ref).magnitude());
+    }
+
+    SERIAL_ECHOLNPGM("SCARA IK per second, library trig: ", rate(_inverse_kinematics<float_trig>),
+                     " fast trig: ", rate(_inverse_kinematics<fast_trig>));
+    test_max_error(F("SCARA IK fast trig max position error"), worst * 1000, 2, F("um"));
+  }
+
+#endif
+
+#ifdef SCARA_SEGMENT_DEVIATION
+
+  /**
+   * Take the second difference of the joint angles 1mm to either side of
+   * the point. An angle error moves the arm end by up to the full arm
+   * length times the angle in radians.
+   */
+  static float joint_curvature(const xyz_pos_t &raw, const xyz_float_t &unit) {
+    inverse_kinematics(raw - unit); const abce_pos_t j0 = delta;
+    inverse_kinematics(raw);        const abce_pos_t j1 = delta;
+    inverse_kinematics(raw + unit); const abce_pos_t j2 = delta;
+    const abce_float_t bend = j0 + j2 - j1 * 2;
+    const float degrees = _MAX(ABS(bend.a), ABS(bend.b) OPTARG(AXEL_TPARA, ABS(bend.c)));
+    return RADIANS(degrees) * (L1 + L2);
+  }
+
+  /**
+   * The arm swings fastest where the move passes closest to the base, so
+   * check the point where the base projects onto the move, along with the
+   * ends and the middle.
+   */
+  float kinematic_curvature(const xyz_pos_t &start, const xyz_float_t &unit, const_float_t length) {
+    float curvature = _MAX(joint_curvature(start, unit), joint_curvature(start + unit * (length * 0.5f), unit), joint_curvature(start + unit * length, unit));
+    const float uxy2 = HYPOT2(unit.x, unit.y);
+    if (uxy2) {
+      #if ENABLED(AXEL_TPARA)
+        const xy_pos_t base = robot_offset;
+      #elif ENABLED(MORGAN_SCARA)
+        const xy_pos_t base = scara_offset;
+      #else
+        const xy_pos_t base = { 0, 0 };
+      #endif
+      const float nearest = ((base.x - start.x) * unit.x + (base.y - start.y) * unit.y) / uxy2;
+      if (nearest > 0 && nearest < length) NOLESS(curvature, joint_curvature(start + unit * nearest, unit));
+    }
+    return curvature;
+  }
+
+#endif
+
 void scara_report_positions() {
   SERIAL_ECHOLNPGM("SCARA Theta:", planner.get_axis_position_degrees(A_AXIS)
     #if ENABLED(AXEL_TPARA)
@@ -49,5 +49,18 @@ extern float segments_per_second;
 #endif
 
 void inverse_kinematics(const xyz_pos_t &raw);
+
+#if ENABLED(MARLIN_TEST_BUILD)
+  void test_scara_ik();
+#endif
+
+#ifdef SCARA_SEGMENT_DEVIATION
+  /**
+   * Estimate how sharply the arm joints bend (1/mm) along a move of
+   * 'length' from 'start' in the direction of 'unit'. A segment of length L
+   * strays from the true path by about L^2 / 8 times this.
+   */
+  float kinematic_curvature(const xyz_pos_t &start, const xyz_float_t &unit, const_float_t length);
+#endif
 void scara_set_axis_is_at_home(const AxisEnum axis);
 void scara_report_positions();
@@ -36,7 +36,7 @@
  */
 
 // Change EEPROM version if the structure changes
-#define EEPROM_VERSION "V86"
+#define EEPROM_VERSION "V90"
 #define EEPROM_OFFSET 100
 
 // Check the integrity of data offsets.
@@ -171,6 +171,14 @@
   #include "../lcd/extui/dgus/DGUSDisplayDef.h"
 #endif
 
+#if ENABLED(FT_MOTION)
+  #include "ft_motion.h"
+#endif
+
+#if ENABLED(SEGMENT_COALESCING)
+  #include "../feature/coalescer.h"
+#endif
+
 #pragma pack(push, 1) // No padding between variables
 
 #if HAS_ETHERNET
@@ -431,6 +439,13 @@ typedef struct SettingsDataStruct {
   float planner_filament_size[EXTRUDERS];               // M200 T D  planner.filament_size[]
   float planner_volumetric_extruder_limit[EXTRUDERS];   // M200 T L  planner.volumetric_extruder_limit[]
 
+  //
+  // NONLINEAR_EXTRUSION
+  //
+  #if ENABLED(NONLINEAR_EXTRUSION)
+    nonlinear_extrusion_t planner_nonlinear_extrusion[EXTRUDERS]; // M592 T A B
+  #endif
+
   //
   // HAS_TRINAMIC_CONFIG
   //
@@ -573,6 +588,35 @@ typedef struct SettingsDataStruct {
     MPC_t mpc_constants[HOTENDS];                       // M306
   #endif
 
+  //
+  // Input Shaping
+  //
+  #if ENABLED(INPUT_SHAPING_X)
+    float shaping_x_frequency,                          // M593 X F
+          shaping_x_zeta;                               // M593 X D
+    uint8_t shaping_x_type;                             // M593 X T
+  #endif
+  #if ENABLED(INPUT_SHAPING_Y)
+    float shaping_y_frequency,                          // M593 Y F
+          shaping_y_zeta;                               // M593 Y D
+    uint8_t shaping_y_type;                             // M593 Y T
+  #endif
+
+  //
+  // Fixed-Time Motion
+  //
+  #if ENABLED(FT_MOTION)
+    bool ftm_active;                                    // M493 S
+  #endif
+
+  //
+  // Segment Coalescing
+  //
+  #if ENABLED(SEGMENT_COALESCING)
+    bool coalesce_enabled;                              // M494 S
+    float coalesce_tolerance;                           // M494 T
+  #endif
+
 } SettingsData;
 
 //static_assert(sizeof(SettingsData) <= MARLIN_EEPROM_SIZE, "EEPROM too small to contain SettingsData!");
@@ -617,6 +661,7 @@ void MarlinSettings::postprocess() {
   TERN_(ENABLE_LEVELING_FADE_HEIGHT, set_z_fade_height(new_z_fade_height, false)); // false = no report
 
   TERN_(AUTO_BED_LEVELING_BILINEAR, bedlevel.refresh_bed_level());
+  TERN_(UBL_CELL_CACHE, bedlevel.refresh_bed_level());
 
   TERN_(HAS_MOTOR_CURRENT_PWM, stepper.refresh_motor_power());
 
@@ -1230,6 +1275,14 @@ void MarlinSettings::postprocess() {
       #endif
     }
 
+    //
+    // Nonlinear Extrusion
+    //
+    #if ENABLED(NONLINEAR_EXTRUSION)
+      _FIELD_TEST(planner_nonlinear_extrusion);
+      EEPROM_WRITE(planner.nonlinear_extrusion);
+    #endif
+
     //
     // TMC Configuration
     //
@@ -1612,6 +1665,34 @@ void MarlinSettings::postprocess() {
         EEPROM_WRITE(thermalManager.temp_hotend[e].constants);
     #endif
 
+    //
+    // Input Shaping
+    //
+    #if HAS_SHAPING
+      #define _SHAPING_WRITE(A) do{ \
+        EEPROM_WRITE(stepper.get_shaping_frequency(_AXIS(A))); \
+        EEPROM_WRITE(stepper.get_shaping_damping_ratio(_AXIS(A))); \
+        EEPROM_WRITE(stepper.get_shaping_type(_AXIS(A))); \
+      }while(0)
+      TERN_(INPUT_SHAPING_X, _SHAPING_WRITE(X));
+      TERN_(INPUT_SHAPING_Y, _SHAPING_WRITE(Y));
+    #endif
+
+    //
+    // Fixed-Time Motion
+    //
+    #if ENABLED(FT_MOTION)
+      EEPROM_WRITE(ftMotion.active);
+    #endif
+
+    //
+    // Segment Coalescing
+    //
+    #if ENABLED(SEGMENT_COALESCING)
+      EEPROM_WRITE(coalescer.enabled);
+      EEPROM_WRITE(coalescer.tolerance);
+    #endif
+
     //
     // Report final CRC and Data Size
     //
@@ -2176,6 +2257,18 @@ void MarlinSettings::postprocess() {
         #endif
       }
 
+      //
+      // Nonlinear Extrusion
+      //
+      #if ENABLED(NONLINEAR_EXTRUSION)
+      {
+        nonlinear_extrusion_t nonlinear_extrusion[EXTRUDERS];
+        _FIELD_TEST(planner_nonlinear_extrusion);
+        EEPROM_READ(nonlinear_extrusion);
+        if (!validating) COPY(planner.nonlinear_extrusion, nonlinear_extrusion);
+      }
+      #endif
+
       //
       // TMC Stepper Settings
       //
@@ -2592,6 +2685,53 @@ void MarlinSettings::postprocess() {
       }
       #endif
 
+      //
+      // Input Shaping
+      //
+      #if HAS_SHAPING
+      {
+        #define _SHAPING_READ(A) do{ \
+          float freq; float zeta; uint8_t type; \
+          EEPROM_READ(freq); EEPROM_READ(zeta); EEPROM_READ(type); \
+          if (!validating) { \
+            stepper.set_shaping_frequency(_AXIS(A), freq); \
+            stepper.set_shaping_damping_ratio(_AXIS(A), zeta); \
+            stepper.set_shaping_type(_AXIS(A), ShaperType(type)); \
+          } \
+        }while(0)
+        TERN_(INPUT_SHAPING_X, _SHAPING_READ(X));
+        TERN_(INPUT_SHAPING_Y, _SHAPING_READ(Y));
+      }
+      #endif
+
+      //
+      // Fixed-Time Motion
+      //
+      #if ENABLED(FT_MOTION)
+      {
+        bool ftm_active;
+        EEPROM_READ(ftm_active);
+        if (!validating) ftMotion.set_active(ftm_active);
+      }
+      #endif
+
+      //
+      // Segment Coalescing
+      //
+      #if ENABLED(SEGMENT_COALESCING)
+      {
+        _FIELD_TEST(coalesce_enabled);
+        bool coalesce_enabled;
+        float coalesce_tolerance;
+        EEPROM_READ(coalesce_enabled);
+        EEPROM_READ(coalesce_tolerance);
+        if (!validating) {
+          coalescer.enabled = coalesce_enabled;
+          coalescer.tolerance = coalesce_tolerance;
+        }
+      }
+      #endif
+
       //
       // Validate Final Size and CRC
       //
@@ -2790,6 +2930,8 @@ void MarlinSettings::postprocess() {
             bedlevel.set_mesh_from_store(z_mesh_store, bedlevel.z_values);
         #endif
 
+        if (!into) bedlevel.refresh_bed_level();
+
         #if ENABLED(DWIN_LCD_PROUI)
           status = !BedLevelTools.meshvalidate();
           if (status) {
@@ -3231,6 +3373,10 @@ void MarlinSettings::reset() {
       LOOP_L_N(q, COUNT(planner.volumetric_extruder_limit))
         planner.volumetric_extruder_limit[q] = DEFAULT_VOLUMETRIC_EXTRUDER_LIMIT;
     #endif
+    #if ENABLED(NONLINEAR_EXTRUSION)
+      EXTRUDER_LOOP()
+        planner.nonlinear_extrusion[e] = { NONLINEAR_EXTRUSION_DEFAULT_A, NONLINEAR_EXTRUSION_DEFAULT_B };
+    #endif
   #endif
 
   endstops.enable_globally(ENABLED(ENDSTOPS_ALWAYS_ON_DEFAULT));
@@ -3353,6 +3499,33 @@ void MarlinSettings::reset() {
     }
   #endif
 
+  //
+  // Input Shaping
+  //
+  #if ENABLED(INPUT_SHAPING_X)
+    stepper.set_shaping_frequency(X_AXIS, SHAPING_FREQ_X);
+    stepper.set_shaping_damping_ratio(X_AXIS, SHAPING_ZETA_X);
+    stepper.set_shaping_type(X_AXIS, SHAPING_TYPE_X);
+  #endif
+  #if ENABLED(INPUT_SHAPING_Y)
+    stepper.set_shaping_frequency(Y_AXIS, SHAPING_FREQ_Y);
+    stepper.set_shaping_damping_ratio(Y_AXIS, SHAPING_ZETA_Y);
+    stepper.set_shaping_type(Y_AXIS, SHAPING_TYPE_Y);
+  #endif
+
+  //
+  // Fixed-Time Motion
+  //
+  TERN_(FT_MOTION, ftMotion.set_active(FTM_DEFAULT_ACTIVE));
+
+  //
+  // Segment Coalescing
+  //
+  #if ENABLED(SEGMENT_COALESCING)
+    coalescer.enabled = COALESCE_DEFAULT_ENABLED;
+    coalescer.tolerance = COALESCE_TOLERANCE;
+  #endif
+
   postprocess();
 
   #if EITHER(EEPROM_CHITCHAT, DEBUG_LEVELING_FEATURE)
@@ -3607,6 +3780,11 @@ void MarlinSettings::reset() {
     //
     TERN_(LIN_ADVANCE, gcode.M900_report(forReplay));
 
+    //
+    // Nonlinear Extrusion
+    //
+    TERN_(NONLINEAR_EXTRUSION, gcode.M592_report(forReplay));
+
     //
     // Motor Current (SPI or PWM)
     //
@@ -3649,6 +3827,21 @@ void MarlinSettings::reset() {
     // Model predictive control
     //
     TERN_(MPCTEMP, gcode.M306_report(forReplay));
+
+    //
+    // Input Shaping
+    //
+    TERN_(HAS_SHAPING, gcode.M593_report(forReplay));
+
+    //
+    // Fixed-Time Motion
+    //
+    TERN_(FT_MOTION, gcode.M493_report(forReplay));
+
+    //
+    // Segment Coalescing
+    //
+    TERN_(SEGMENT_COALESCING, gcode.M494_report(forReplay));
   }
 
 #endif // !DISABLE_M503
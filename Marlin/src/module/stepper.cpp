@@ -137,6 +137,10 @@ Stepper stepper; // Singleton
   #include "../lcd/extui/ui_api.h"
 #endif
 
+#if ENABLED(FT_MOTION)
+  #include "ft_motion.h"
+#endif
+
 // public:
 
 #if EITHER(HAS_EXTRA_ENDSTOPS, Z_STEPPER_AUTO_ALIGN)
@@ -232,10 +236,30 @@ uint32_t Stepper::advance_divisor = 0,
   uint32_t Stepper::nextBabystepISR = BABYSTEP_NEVER;
 #endif
 
+#if HAS_SHAPING
+  shaping_time_t Stepper::shaping_now = 0;
+  #if ENABLED(INPUT_SHAPING_X)
+    ShapeParams Stepper::shaping_x;
+    ShapingQueue<SHAPING_QUEUE_SIZE(X)> Stepper::shaping_queue_x;
+  #endif
+  #if ENABLED(INPUT_SHAPING_Y)
+    ShapeParams Stepper::shaping_y;
+    ShapingQueue<SHAPING_QUEUE_SIZE(Y)> Stepper::shaping_queue_y;
+  #endif
+#endif
+
 #if ENABLED(DIRECT_STEPPING)
   page_step_state_t Stepper::page_step_state;
 #endif
 
+#if ENABLED(STEP_EVENT_QUEUE)
+  step_event_t Stepper::step_events[STEP_EVENT_QUEUE_SIZE];
+  volatile uint16_t Stepper::step_event_head = 0, Stepper::step_event_tail = 0;
+  uint16_t Stepper::step_event_fill = 0;
+  volatile bool Stepper::step_events_producing = false;
+  axis_bits_t Stepper::step_event_dirs = 0;
+#endif
+
 int32_t Stepper::ticks_nominal = -1;
 #if DISABLED(S_CURVE_ACCELERATION)
   uint32_t Stepper::acc_step_rate; // needed for deceleration start point
@@ -473,6 +497,28 @@ xyze_int8_t Stepper::count_direction{0};
   #define DIR_WAIT_AFTER()
 #endif
 
+#if HAS_SHAPING
+  /**
+   * Add a weighted part of a commanded step (in 1/128 step) to a shaped axis.
+   * Set STEP if the motor is due to step, reversing its DIR pin if needed.
+   */
+  #define SHAPING_APPLY(AXIS, Q, DELTA, STEP) do{ \
+    int16_t &de = shaping_##Q.delta_error; \
+    de += (DELTA); \
+    const bool fwd = de >= 64; \
+    STEP = fwd || de < -64; \
+    if (STEP) { \
+      de += fwd ? -128 : 128; \
+      if (fwd != shaping_##Q.forward) { \
+        shaping_##Q.forward = fwd; \
+        DIR_WAIT_BEFORE(); \
+        AXIS##_APPLY_DIR(fwd ? !INVERT_##AXIS##_DIR : INVERT_##AXIS##_DIR, false); \
+        DIR_WAIT_AFTER(); \
+      } \
+    } \
+  }while(0)
+#endif
+
 void Stepper::enable_axis(const AxisEnum axis) {
   #define _CASE_ENABLE(N) case N##_AXIS: ENABLE_AXIS_##N(); break;
   switch (axis) {
@@ -586,6 +632,10 @@ void Stepper::set_directions() {
   TERN_(HAS_V_DIR, SET_STEP_DIR(V));
   TERN_(HAS_W_DIR, SET_STEP_DIR(W));
 
+  // Shaped steps may reverse the DIR pin, so keep track of its state
+  TERN_(INPUT_SHAPING_X, shaping_x.forward = !motor_direction(X_AXIS));
+  TERN_(INPUT_SHAPING_Y, shaping_y.forward = !motor_direction(Y_AXIS));
+
   #if ENABLED(MIXING_EXTRUDER)
      // Because this is valid for the whole block we don't know
      // what E steppers will step. Likely all. Set all.
@@ -608,6 +658,8 @@ void Stepper::set_directions() {
     }
   #endif
 
+  TERN_(STEP_EVENT_QUEUE, step_event_dirs = last_direction_bits);
+
   DIR_WAIT_AFTER();
 }
 
@@ -1463,7 +1515,24 @@ void Stepper::isr() {
     // Enable ISRs to reduce USART processing latency
     hal.isr_on();
 
-    if (!nextMainISR) pulse_phase_isr();                // 0 = Do coordinated axes Stepper pulses
+    #if ENABLED(FT_MOTION)
+      if (ftMotion.active) {                            // Fixed-Time Motion replaces the Pulse / Block phases
+        if (!nextMainISR) {
+          ft_motion_isr();
+          nextMainISR = FTM_STEPPER_TICKS;
+        }
+      }
+      else
+    #endif
+    #if ENABLED(STEP_EVENT_QUEUE)
+      if (!nextMainISR) nextMainISR = step_event_isr(); // 0 = Take the next queued step event
+    #else
+      if (!nextMainISR) pulse_phase_isr();              // 0 = Do coordinated axes Stepper pulses
+    #endif
+
+    #if HAS_SHAPING
+      if (!shaping_next_due()) shaping_isr();           // 0 = Do Input Shaping echo pulses
+    #endif
 
     #if ENABLED(LIN_ADVANCE)
       if (!nextAdvanceISR) {                            // 0 = Do Linear Advance E Stepper pulses
@@ -1481,7 +1550,9 @@ void Stepper::isr() {
 
     // ^== Time critical. NOTHING besides pulse generation should be above here!!!
 
-    if (!nextMainISR) nextMainISR = block_phase_isr();  // Manage acc/deceleration, get next block
+    #if DISABLED(STEP_EVENT_QUEUE)
+      if (!nextMainISR) nextMainISR = block_phase_isr(); // Manage acc/deceleration, get next block
+    #endif
 
     #if ENABLED(INTEGRATED_BABYSTEPPING)
       if (is_babystep)                                  // Avoid ANY stepping too soon after baby-stepping
@@ -1497,6 +1568,7 @@ void Stepper::isr() {
       nextMainISR                                       // Time until the next Pulse / Block phase
       OPTARG(LIN_ADVANCE, nextAdvanceISR)               // Come back early for Linear Advance?
       OPTARG(INTEGRATED_BABYSTEPPING, nextBabystepISR)  // Come back early for Babystepping?
+      OPTARG(HAS_SHAPING, shaping_next_due())           // Come back early for Input Shaping echoes?
     );
 
     //
@@ -1516,6 +1588,8 @@ void Stepper::isr() {
       if (nextBabystepISR != BABYSTEP_NEVER) nextBabystepISR -= interval;
     #endif
 
+    TERN_(HAS_SHAPING, shaping_now += interval);        // Echo delays are relative to this clock
+
     /**
      * This needs to avoid a race-condition caused by interleaving
      * of interrupts required by both the LA and Stepper algorithms.
@@ -1591,7 +1665,7 @@ void Stepper::isr() {
 #if MINIMUM_STEPPER_PULSE || MAXIMUM_STEPPER_RATE
   #define ISR_PULSE_CONTROL 1
 #endif
-#if ISR_PULSE_CONTROL && DISABLED(I2S_STEPPER_STREAM)
+#if ISR_PULSE_CONTROL && NONE(I2S_STEPPER_STREAM, STEP_EVENT_QUEUE)
   #define ISR_MULTI_STEPS 1
 #endif
 
@@ -1607,6 +1681,7 @@ void Stepper::pulse_phase_isr() {
   // If we must abort the current block, do so!
   if (abort_current_block) {
     abort_current_block = false;
+    TERN_(STEP_EVENT_QUEUE, discard_step_events());
     if (current_block) discard_current_block();
   }
 
@@ -1644,19 +1719,45 @@ void Stepper::pulse_phase_isr() {
       } \
     }while(0)
 
-    // Start an active pulse if needed
-    #define PULSE_START(AXIS) do{ \
+    // Split a commanded step into its first impulse and queue the delayed echoes
+    #define PULSE_PREP_SHAPING(AXIS, Q) do{ \
       if (step_needed[_AXIS(AXIS)]) { \
-        _APPLY_STEP(AXIS, !_INVERT_STEP_PIN(AXIS), 0); \
+        const bool fwd = count_direction[_AXIS(AXIS)] > 0; \
+        int16_t weight = 128; \
+        if (shaping_##Q.echoes && !shaping_queue_##Q.full()) { \
+          shaping_queue_##Q.enqueue(shaping_now, fwd); \
+          weight = shaping_##Q.factor[0]; \
+        } \
+        SHAPING_APPLY(AXIS, Q, fwd ? weight : -weight, step_needed[_AXIS(AXIS)]); \
       } \
     }while(0)
 
-    // Stop an active pulse if needed
-    #define PULSE_STOP(AXIS) do { \
-      if (step_needed[_AXIS(AXIS)]) { \
-        _APPLY_STEP(AXIS, _INVERT_STEP_PIN(AXIS), 0); \
-      } \
-    }while(0)
+    #if ENABLED(STEP_EVENT_QUEUE)
+
+      // Record the steps for the Stepper ISR to take later
+      axis_bits_t event_bits = 0;
+      #define PULSE_START(AXIS) do{ \
+        if (step_needed[_AXIS(AXIS)]) SBI(event_bits, _AXIS(AXIS)); \
+      }while(0)
+      #define PULSE_STOP(AXIS) NOOP
+
+    #else
+
+      // Start an active pulse if needed
+      #define PULSE_START(AXIS) do{ \
+        if (step_needed[_AXIS(AXIS)]) { \
+          _APPLY_STEP(AXIS, !_INVERT_STEP_PIN(AXIS), 0); \
+        } \
+      }while(0)
+
+      // Stop an active pulse if needed
+      #define PULSE_STOP(AXIS) do { \
+        if (step_needed[_AXIS(AXIS)]) { \
+          _APPLY_STEP(AXIS, _INVERT_STEP_PIN(AXIS), 0); \
+        } \
+      }while(0)
+
+    #endif
 
     // Direct Stepping page?
     const bool is_page = current_block->is_page();
@@ -1771,9 +1872,11 @@ void Stepper::pulse_phase_isr() {
       // Determine if pulses are needed
       #if HAS_X_STEP
         PULSE_PREP(X);
+        TERN_(INPUT_SHAPING_X, PULSE_PREP_SHAPING(X, x));
       #endif
       #if HAS_Y_STEP
         PULSE_PREP(Y);
+        TERN_(INPUT_SHAPING_Y, PULSE_PREP_SHAPING(Y, y));
       #endif
       #if HAS_Z_STEP
         PULSE_PREP(Z);
@@ -1901,6 +2004,11 @@ void Stepper::pulse_phase_isr() {
       if (events_to_do) START_LOW_PULSE();
     #endif
 
+    #if ENABLED(STEP_EVENT_QUEUE)
+      step_events[step_event_fill] = { 0, event_bits, last_direction_bits };
+      step_event_fill = next_step_event(step_event_fill);
+    #endif
+
   } while (--events_to_do);
 }
 
@@ -2365,21 +2473,25 @@ uint32_t Stepper::block_phase_isr() {
       #endif
 
       // Based on the oversampling factor, do the calculations
-      step_event_count = current_block->step_event_count << oversampling;
+      step_event_count = uint32_t(current_block->step_event_count) << oversampling;
 
       // Initialize Bresenham delta errors to 1/2
       delta_error = TERN_(LIN_ADVANCE, la_delta_error =) -int32_t(step_event_count);
 
       // Calculate Bresenham dividends and divisors
-      advance_dividend = current_block->steps << 1;
+      #if ENABLED(COMPACT_PLANNER_BLOCKS)
+        LOOP_LOGICAL_AXES(i) advance_dividend[i] = uint32_t(current_block->steps[i]) << 1;
+      #else
+        advance_dividend = current_block->steps << 1;
+      #endif
       advance_divisor = step_event_count << 1;
 
       // No step events completed so far
       step_events_completed = 0;
 
       // Compute the acceleration and deceleration points
-      accelerate_until = current_block->accelerate_until << oversampling;
-      decelerate_after = current_block->decelerate_after << oversampling;
+      accelerate_until = uint32_t(current_block->accelerate_until) << oversampling;
+      decelerate_after = uint32_t(current_block->decelerate_after) << oversampling;
 
       TERN_(MIXING_EXTRUDER, mixer.stepper_setup(current_block->b_color));
 
@@ -2402,7 +2514,13 @@ uint32_t Stepper::block_phase_isr() {
         || TERN(MIXING_EXTRUDER, false, stepper_extruder != last_moved_extruder)
       ) {
         E_TERN_(last_moved_extruder = stepper_extruder);
-        set_directions(current_block->direction_bits);
+        #if ENABLED(STEP_EVENT_QUEUE)
+          // The Stepper ISR sets DIR pins along with the first step of the block
+          last_direction_bits = current_block->direction_bits;
+          LOOP_LOGICAL_AXES(i) count_direction[i] = TEST(last_direction_bits, i) ? -1 : 1;
+        #else
+          set_directions(current_block->direction_bits);
+        #endif
       }
 
       #if ENABLED(LASER_FEATURE)
@@ -2502,6 +2620,361 @@ uint32_t Stepper::block_phase_isr() {
 
 #endif // LIN_ADVANCE
 
+#if ENABLED(FT_MOTION)
+
+  /**
+   * Play back the next Fixed-Time Motion command, if any. The commands were
+   * generated from planner blocks by FTMotion::loop() in the main thread.
+   */
+  void Stepper::ft_motion_isr() {
+
+    // Aborting the current block drops all generated commands
+    if (abort_current_block) {
+      abort_current_block = false;
+      ftMotion.abort();
+    }
+
+    if (TERN0(FREEZE_FEATURE, frozen)) return;
+
+    ft_command_t cmd;
+    if (!ftMotion.next_command(cmd)) return;
+
+    if (cmd.dir_bits != last_direction_bits) set_directions(cmd.dir_bits);
+
+    if (!cmd.step_bits) return;
+
+    USING_TIMED_PULSE();
+
+    #define _FTM_STEP(AXIS) if (TEST(cmd.step_bits, _AXIS(AXIS))) AXIS##_APPLY_STEP(!INVERT_##AXIS##_STEP_PIN, false)
+    #define _FTM_UNSTEP(AXIS) if (TEST(cmd.step_bits, _AXIS(AXIS))) AXIS##_APPLY_STEP(INVERT_##AXIS##_STEP_PIN, false)
+
+    LOGICAL_AXIS_CODE(
+      _FTM_STEP(E),
+      _FTM_STEP(X), _FTM_STEP(Y), _FTM_STEP(Z),
+      _FTM_STEP(I), _FTM_STEP(J), _FTM_STEP(K),
+      _FTM_STEP(U), _FTM_STEP(V), _FTM_STEP(W)
+    );
+
+    START_HIGH_PULSE();
+    LOOP_LOGICAL_AXES(i) if (TEST(cmd.step_bits, i)) count_position[i] += count_direction[i];
+    AWAIT_HIGH_PULSE();
+
+    LOGICAL_AXIS_CODE(
+      _FTM_UNSTEP(E),
+      _FTM_UNSTEP(X), _FTM_UNSTEP(Y), _FTM_UNSTEP(Z),
+      _FTM_UNSTEP(I), _FTM_UNSTEP(J), _FTM_UNSTEP(K),
+      _FTM_UNSTEP(U), _FTM_UNSTEP(V), _FTM_UNSTEP(W)
+    );
+  }
+
+#endif // FT_MOTION
+
+#if ENABLED(STEP_EVENT_QUEUE)
+
+  /**
+   * Take the next queued step event, computing more events first if the
+   * queue has run dry. Return the number of ticks until the next event.
+   */
+  uint32_t Stepper::step_event_isr() {
+
+    // Compute events here unless the main loop is already doing it
+    if (abort_current_block || step_event_head == step_event_tail) {
+      if (step_events_producing) return (STEPPER_TIMER_TICKS_PER_US) * 20;
+      produce_step_events();
+    }
+
+    if (TERN0(FREEZE_FEATURE, frozen)) return (STEPPER_TIMER_RATE) / 1000UL;
+
+    const step_event_t &ev = step_events[step_event_tail];
+
+    if (ev.dir_bits != step_event_dirs) apply_step_event_dirs(ev.dir_bits);
+
+    if (ev.step_bits) {
+      USING_TIMED_PULSE();
+
+      #define _EVENT_STEP(AXIS) if (TEST(ev.step_bits, _AXIS(AXIS))) AXIS##_APPLY_STEP(!INVERT_##AXIS##_STEP_PIN, false)
+      #define _EVENT_UNSTEP(AXIS) if (TEST(ev.step_bits, _AXIS(AXIS))) AXIS##_APPLY_STEP(INVERT_##AXIS##_STEP_PIN, false)
+
+      LOGICAL_AXIS_CODE(
+        _EVENT_STEP(E),
+        _EVENT_STEP(X), _EVENT_STEP(Y), _EVENT_STEP(Z),
+        _EVENT_STEP(I), _EVENT_STEP(J), _EVENT_STEP(K),
+        _EVENT_STEP(U), _EVENT_STEP(V), _EVENT_STEP(W)
+      );
+
+      START_HIGH_PULSE();
+      AWAIT_HIGH_PULSE();
+
+      LOGICAL_AXIS_CODE(
+        _EVENT_UNSTEP(E),
+        _EVENT_UNSTEP(X), _EVENT_UNSTEP(Y), _EVENT_UNSTEP(Z),
+        _EVENT_UNSTEP(I), _EVENT_UNSTEP(J), _EVENT_UNSTEP(K),
+        _EVENT_UNSTEP(U), _EVENT_UNSTEP(V), _EVENT_UNSTEP(W)
+      );
+    }
+
+    const uint32_t interval = ev.interval;
+    step_event_tail = next_step_event(step_event_tail);
+    return interval;
+  }
+
+  /**
+   * Run one Pulse phase and Block phase, recording the steps as events.
+   * The time until the next Pulse phase is shared evenly by the steps,
+   * so multi-stepping no longer bunches them up.
+   */
+  void Stepper::produce_step_events() {
+    step_event_fill = step_event_head;
+
+    pulse_phase_isr();
+    const uint32_t interval = block_phase_isr();
+
+    // No steps were taken, so just let the time pass
+    if (step_event_fill == step_event_head) {
+      step_events[step_event_fill] = { 0, 0, last_direction_bits };
+      step_event_fill = next_step_event(step_event_fill);
+    }
+
+    const uint16_t count = (step_event_fill - step_event_head) & (STEP_EVENT_QUEUE_SIZE - 1);
+    const uint32_t share = interval / count;
+    uint16_t i = step_event_head;
+    for (uint16_t n = count; --n; i = next_step_event(i)) step_events[i].interval = share;
+    step_events[i].interval = interval - share * (count - 1);
+
+    // Hand the complete events over to the Stepper ISR
+    hal.isr_off();
+    step_event_head = step_event_fill;
+    hal.isr_on();
+  }
+
+  /**
+   * Drop all queued events when a block is aborted, taking back
+   * the steps they added to the stepper positions.
+   */
+  void Stepper::discard_step_events() {
+    hal.isr_off();
+    for (uint16_t i = step_event_tail; i != step_event_fill; i = next_step_event(i)) {
+      const step_event_t &ev = step_events[i];
+      LOOP_LOGICAL_AXES(a) if (TEST(ev.step_bits, a)) count_position[a] -= TEST(ev.dir_bits, a) ? -1 : 1;
+    }
+    step_event_tail = step_event_head = step_event_fill;
+    hal.isr_on();
+  }
+
+  // Set the DIR pins for the steps of an event
+  void Stepper::apply_step_event_dirs(const axis_bits_t bits) {
+    DIR_WAIT_BEFORE();
+
+    #define _EVENT_DIR(A) A##_APPLY_DIR(TEST(bits, _AXIS(A)) ? INVERT_##A##_DIR : !INVERT_##A##_DIR, false)
+
+    TERN_(HAS_X_DIR, _EVENT_DIR(X));
+    TERN_(HAS_Y_DIR, _EVENT_DIR(Y));
+    TERN_(HAS_Z_DIR, _EVENT_DIR(Z));
+    TERN_(HAS_I_DIR, _EVENT_DIR(I));
+    TERN_(HAS_J_DIR, _EVENT_DIR(J));
+    TERN_(HAS_K_DIR, _EVENT_DIR(K));
+    TERN_(HAS_U_DIR, _EVENT_DIR(U));
+    TERN_(HAS_V_DIR, _EVENT_DIR(V));
+    TERN_(HAS_W_DIR, _EVENT_DIR(W));
+
+    #if HAS_EXTRUDERS
+      if (TEST(bits, E_AXIS)) REV_E_DIR(stepper_extruder); else NORM_E_DIR(stepper_extruder);
+    #endif
+
+    step_event_dirs = bits;
+
+    DIR_WAIT_AFTER();
+  }
+
+  /**
+   * Compute step events for the current block while there's room in the
+   * queue. The Stepper ISR starts each new block, so when the main loop
+   * is stalled or moves are few and far between it steps as it always has.
+   * Endstops and probes need the position as each step is taken, so while
+   * they're enabled the Stepper ISR computes each step just in time.
+   */
+  void Stepper::fill_step_events() {
+    if (endstops.abort_enabled()) return;
+
+    // Keep the Stepper ISR from computing events meanwhile
+    hal.isr_off();
+    step_events_producing = true;
+    hal.isr_on();
+
+    while (current_block && !abort_current_block && step_events_free() > steps_per_isr)
+      produce_step_events();
+
+    hal.isr_off();
+    step_events_producing = false;
+    hal.isr_on();
+  }
+
+#endif // STEP_EVENT_QUEUE
+
+#if HAS_SHAPING
+
+  // Ticks until the next echo step is due on any shaped axis
+  uint32_t Stepper::shaping_next_due() {
+    uint32_t due = SHAPING_NEVER;
+    #if ENABLED(INPUT_SHAPING_X)
+      LOOP_L_N(e, shaping_x.echoes) NOMORE(due, shaping_queue_x.ticks_until(e, shaping_now));
+    #endif
+    #if ENABLED(INPUT_SHAPING_Y)
+      LOOP_L_N(e, shaping_y.echoes) NOMORE(due, shaping_queue_y.ticks_until(e, shaping_now));
+    #endif
+    return due;
+  }
+
+  /**
+   * Issue all echo steps that have come due. Each round takes at most one step
+   * from each echo, so the combined weight can't be more than one motor step.
+   */
+  void Stepper::shaping_isr() {
+    USING_TIMED_PULSE();
+    START_LOW_PULSE();  // The main pulse phase may have just stepped
+
+    #define _SHAPING_ECHO(AXIS, Q) \
+      LOOP_L_N(e, shaping_##Q.echoes) \
+        if (!shaping_queue_##Q.ticks_until(e, shaping_now)) { \
+          const int16_t w = shaping_##Q.factor[e + 1]; \
+          delta.Q += shaping_queue_##Q.dequeue(e) ? w : -w; \
+          any_due = true; \
+        }
+
+    for (;;) {
+      xy_int_t delta{0};
+      bool any_due = false;
+      TERN_(INPUT_SHAPING_X, _SHAPING_ECHO(X, x));
+      TERN_(INPUT_SHAPING_Y, _SHAPING_ECHO(Y, y));
+      if (!any_due) break;
+
+      xy_bool_t step_needed{0};
+      TERN_(INPUT_SHAPING_X, if (delta.x) SHAPING_APPLY(X, x, delta.x, step_needed.x));
+      TERN_(INPUT_SHAPING_Y, if (delta.y) SHAPING_APPLY(Y, y, delta.y, step_needed.y));
+      if (!(step_needed.x || step_needed.y)) continue;
+
+      AWAIT_LOW_PULSE();
+      TERN_(INPUT_SHAPING_X, if (step_needed.x) X_APPLY_STEP(!INVERT_X_STEP_PIN, false));
+      TERN_(INPUT_SHAPING_Y, if (step_needed.y) Y_APPLY_STEP(!INVERT_Y_STEP_PIN, false));
+
+      START_HIGH_PULSE();
+      AWAIT_HIGH_PULSE();
+
+      TERN_(INPUT_SHAPING_X, if (step_needed.x) X_APPLY_STEP(INVERT_X_STEP_PIN, false));
+      TERN_(INPUT_SHAPING_Y, if (step_needed.y) Y_APPLY_STEP(INVERT_Y_STEP_PIN, false));
+      START_LOW_PULSE();
+    }
+  }
+
+  /**
+   * Calculate the impulse weights and echo delays for the shaper type, frequency,
+   * and damping ratio. See "Input Shaping for Vibration Reduction", Singer & Seering.
+   * Return the number of echoes, or 0 if shaping is disabled.
+   */
+  uint8_t ShapeParams::calc_impulses(shaping_time_t delay[SHAPING_MAX_ECHOES]) {
+    LOOP_L_N(e, SHAPING_MAX_ECHOES) delay[e] = 0;
+    factor[0] = 128;
+    if (frequency <= 0) return (echoes = 0);
+
+    const float df = SQRT(1.0f - sq(zeta)),     // Damped/natural frequency ratio
+                td = 1.0f / (frequency * df),   // Damped period (s)
+                K = expf(-zeta * float(M_PI) / df);
+
+    float amp[SHAPING_MAX_ECHOES + 1], when[SHAPING_MAX_ECHOES + 1] = { 0 };
+    uint8_t n = 3;
+    switch (type) {
+      default:
+      case SHAPER_ZV:
+        n = 2;
+        amp[0] = 1; amp[1] = K;
+        when[1] = 0.5f;
+        break;
+      case SHAPER_ZVD:
+        amp[0] = 1; amp[1] = 2 * K; amp[2] = sq(K);
+        when[1] = 0.5f; when[2] = 1.0f;
+        break;
+      case SHAPER_MZV: {
+        const float K2 = expf(-0.75f * zeta * float(M_PI) / df);
+        amp[0] = 1.0f - float(M_SQRT1_2); amp[1] = (float(M_SQRT2) - 1.0f) * K2; amp[2] = amp[0] * sq(K2);
+        when[1] = 0.375f; when[2] = 0.75f;
+      } break;
+      case SHAPER_EI: {
+        constexpr float vtol = 0.05f;           // Tolerated residual vibration
+        amp[0] = 0.25f * (1.0f + vtol); amp[1] = 0.5f * (1.0f - vtol) * K; amp[2] = amp[0] * sq(K);
+        when[1] = 0.5f; when[2] = 1.0f;
+      } break;
+    }
+
+    float sum = 0;
+    LOOP_L_N(i, n) sum += amp[i];
+
+    // Weights are rounded to 1/128 step, with the last impulse taking up the slack
+    uint8_t left = 128;
+    LOOP_L_N(i, n - 1) {
+      factor[i] = uint8_t(amp[i] * 128 / sum + 0.5f);
+      left -= factor[i];
+    }
+    factor[n - 1] = left;
+
+    LOOP_S_L_N(i, 1, n) {
+      const float ticks = when[i] * td * (STEPPER_TIMER_RATE);
+      delay[i - 1] = ticks < float(SHAPING_TIME_MAX) ? shaping_time_t(ticks) : SHAPING_TIME_MAX;
+    }
+
+    return (echoes = n - 1);
+  }
+
+  ShapeParams& Stepper::shaping_params(const AxisEnum axis) {
+    #if BOTH(INPUT_SHAPING_X, INPUT_SHAPING_Y)
+      return axis == Y_AXIS ? shaping_y : shaping_x;
+    #else
+      UNUSED(axis);
+      return TERN(INPUT_SHAPING_X, shaping_x, shaping_y);
+    #endif
+  }
+
+  // Apply new shaping parameters for an axis. Call only with no motion pending (e.g., after planner.synchronize).
+  void Stepper::refresh_shaping(const AxisEnum axis) {
+    ShapeParams &sp = shaping_params(axis);
+    shaping_time_t delay[SHAPING_MAX_ECHOES];
+
+    const bool was_on = hal.isr_state();
+    hal.isr_off();
+
+    const uint8_t echoes = sp.calc_impulses(delay);
+    sp.delta_error = 0;
+    #if BOTH(INPUT_SHAPING_X, INPUT_SHAPING_Y)
+      if (axis == Y_AXIS) shaping_queue_y.reset(echoes, delay); else shaping_queue_x.reset(echoes, delay);
+    #else
+      TERN(INPUT_SHAPING_X, shaping_queue_x, shaping_queue_y).reset(echoes, delay);
+    #endif
+
+    if (was_on) hal.isr_on();
+  }
+
+  void Stepper::set_shaping_frequency(const AxisEnum axis, const float freq) {
+    shaping_params(axis).frequency = freq;
+    refresh_shaping(axis);
+  }
+
+  float Stepper::get_shaping_frequency(const AxisEnum axis) { return shaping_params(axis).frequency; }
+
+  void Stepper::set_shaping_damping_ratio(const AxisEnum axis, const float zeta) {
+    shaping_params(axis).zeta = zeta;
+    refresh_shaping(axis);
+  }
+
+  float Stepper::get_shaping_damping_ratio(const AxisEnum axis) { return shaping_params(axis).zeta; }
+
+  void Stepper::set_shaping_type(const AxisEnum axis, const ShaperType type) {
+    shaping_params(axis).type = type;
+    refresh_shaping(axis);
+  }
+
+  ShaperType Stepper::get_shaping_type(const AxisEnum axis) { return shaping_params(axis).type; }
+
+#endif // HAS_SHAPING
+
 #if ENABLED(INTEGRATED_BABYSTEPPING)
 
   // Timer interrupt for baby-stepping
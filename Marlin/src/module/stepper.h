@@ -312,12 +312,118 @@ constexpr ena_mask_t enable_overlap[] = {
 
 //static_assert(!any_enable_overlap(), "There is some overlap.");
 
+#if HAS_SHAPING
+
+  // Input shapers. Each one splits a step into 2 or 3 weighted impulses.
+  enum ShaperType : uint8_t { SHAPER_ZV, SHAPER_ZVD, SHAPER_MZV, SHAPER_EI };
+
+  #define SHAPING_MAX_ECHOES 2  // Delayed impulses following the original step
+
+  typedef IF<ENABLED(__AVR__), uint16_t, uint32_t>::type shaping_time_t;
+  constexpr shaping_time_t SHAPING_TIME_MAX = shaping_time_t(-1);
+  constexpr uint32_t SHAPING_NEVER = 0xFFFFFFFF;
+
+  // Size the echo queues to hold all the steps made during the longest echo delay
+  #ifdef SHAPING_MIN_FREQ
+    constexpr float shaping_min_freq = SHAPING_MIN_FREQ;
+  #else
+    constexpr float shaping_min_freq = _MIN(0x7FFFFFFFL OPTARG(INPUT_SHAPING_X, SHAPING_FREQ_X) OPTARG(INPUT_SHAPING_Y, SHAPING_FREQ_Y));
+  #endif
+  static_assert(shaping_min_freq > 0, "SHAPING_MIN_FREQ must be set if SHAPING_FREQ_[XY] is 0.");
+
+  constexpr float shaping_max_feedrate[] = DEFAULT_MAX_FEEDRATE,
+                  shaping_steps_per_unit[] = DEFAULT_AXIS_STEPS_PER_UNIT;
+  #ifdef SHAPING_MAX_STEPRATE
+    #define _SHAPING_STEPRATE(A) float(SHAPING_MAX_STEPRATE)
+  #else
+    #define _SHAPING_STEPRATE(A) (shaping_max_feedrate[_AXIS(A)] * shaping_steps_per_unit[_AXIS(A)])
+  #endif
+  #define SHAPING_QUEUE_SIZE(A) uint16_t(_SHAPING_STEPRATE(A) / shaping_min_freq + 3)
+
+  /**
+   * Ring buffer of commanded steps for one shaped axis. Each echo reads the
+   * buffer through its own head, so a step is only freed once its last (most
+   * delayed) echo has been issued. Only accessed from the Stepper ISR, except
+   * for reset() which is called with interrupts disabled.
+   */
+  template<uint16_t SIZE>
+  class ShapingQueue {
+    private:
+      shaping_time_t times[SIZE];               // ISR time of each commanded step
+      uint8_t fwd_bits[(SIZE + 7) / 8];         // Direction of each commanded step
+      uint16_t tail;                            // Slot for the next commanded step
+      uint16_t head[SHAPING_MAX_ECHOES];        // Next step to echo, for each echo
+      shaping_time_t delay[SHAPING_MAX_ECHOES]; // Delay of each echo, in stepper timer ticks
+      uint8_t echoes;                           // Number of active echoes (0 = not shaping)
+
+    public:
+      void reset(const uint8_t n, const shaping_time_t d[SHAPING_MAX_ECHOES]) {
+        echoes = n;
+        tail = 0;
+        LOOP_L_N(e, SHAPING_MAX_ECHOES) { head[e] = 0; delay[e] = d[e]; }
+      }
+
+      bool empty() const { return !echoes || head[echoes - 1] == tail; }
+
+      bool full() const {
+        const uint16_t next = tail + 1 == SIZE ? 0 : tail + 1;
+        return next == head[echoes - 1];
+      }
+
+      void enqueue(const shaping_time_t now, const bool fwd) {
+        times[tail] = now;
+        SET_BIT_TO(fwd_bits[tail >> 3], tail & 0x7, fwd);
+        if (++tail == SIZE) tail = 0;
+      }
+
+      // Ticks until the given echo is due, or SHAPING_NEVER if it has no steps
+      uint32_t ticks_until(const uint8_t e, const shaping_time_t now) const {
+        if (head[e] == tail) return SHAPING_NEVER;
+        const shaping_time_t age = now - times[head[e]];
+        return age >= delay[e] ? 0 : delay[e] - age;
+      }
+
+      // Pop the next step for the given echo, returning its direction
+      bool dequeue(const uint8_t e) {
+        const uint16_t h = head[e];
+        if (++head[e] == SIZE) head[e] = 0;
+        return TEST(fwd_bits[h >> 3], h & 0x7);
+      }
+  };
+
+  // Runtime shaping parameters and state for one axis
+  struct ShapeParams {
+    float frequency;                          // (Hz) Resonant frequency. 0 = No shaping.
+    float zeta;                               // Damping ratio
+    ShaperType type;
+    uint8_t echoes;                           // Number of delayed impulses in use
+    uint8_t factor[SHAPING_MAX_ECHOES + 1];   // Impulse weights in 1/128 step, summing to 128
+    int16_t delta_error;                      // 128 * (weighted commanded - motor) position
+    bool forward;                             // Current state of the DIR pin
+
+    uint8_t calc_impulses(shaping_time_t delay[SHAPING_MAX_ECHOES]);
+  };
+
+#endif // HAS_SHAPING
+
+#if ENABLED(STEP_EVENT_QUEUE)
+
+  // Steps worked out ahead of time, for the Stepper ISR to take when due
+  typedef struct {
+    uint32_t interval;          // Ticks from this event to the next one
+    axis_bits_t step_bits,      // Axes to step
+                dir_bits;       // Direction bits to apply before stepping
+  } step_event_t;
+
+#endif
+
 //
 // Stepper class definition
 //
 class Stepper {
   friend class KinematicSystem;
   friend class DeltaKinematicSystem;
+  friend class FTMotion;
 
   public:
 
@@ -429,10 +535,31 @@ class Stepper {
       static uint32_t nextBabystepISR;
     #endif
 
+    #if HAS_SHAPING
+      static shaping_time_t shaping_now;  // Running ISR time, used to schedule step echoes
+      #if ENABLED(INPUT_SHAPING_X)
+        static ShapeParams shaping_x;
+        static ShapingQueue<SHAPING_QUEUE_SIZE(X)> shaping_queue_x;
+      #endif
+      #if ENABLED(INPUT_SHAPING_Y)
+        static ShapeParams shaping_y;
+        static ShapingQueue<SHAPING_QUEUE_SIZE(Y)> shaping_queue_y;
+      #endif
+    #endif
+
     #if ENABLED(DIRECT_STEPPING)
       static page_step_state_t page_step_state;
     #endif
 
+    #if ENABLED(STEP_EVENT_QUEUE)
+      static step_event_t step_events[STEP_EVENT_QUEUE_SIZE];
+      static volatile uint16_t step_event_head,   // Next event to publish
+                               step_event_tail;   // Next event to take
+      static uint16_t step_event_fill;            // Next event to record, during a Pulse phase
+      static volatile bool step_events_producing; // The main loop is computing events
+      static axis_bits_t step_event_dirs;         // DIR bits most recently applied to the pins
+    #endif
+
     static int32_t ticks_nominal;
     #if DISABLED(S_CURVE_ACCELERATION)
       static uint32_t acc_step_rate; // needed for deceleration start point
@@ -479,6 +606,27 @@ class Stepper {
       static void advance_isr();
     #endif
 
+    #if ENABLED(FT_MOTION)
+      // The Fixed-Time Motion ISR phase, playing back one step command per tick
+      static void ft_motion_isr();
+    #endif
+
+    #if ENABLED(STEP_EVENT_QUEUE)
+      // Take the next queued step event, returning the ticks to the next one
+      static uint32_t step_event_isr();
+      // Compute step events ahead of the Stepper ISR. Called from idle().
+      static void fill_step_events();
+      // Are there step events still to be taken?
+      static bool step_events_queued() { return step_event_head != step_event_tail; }
+    #endif
+
+    #if HAS_SHAPING
+      // The Input Shaping ISR phase, issuing echo steps that have come due
+      static void shaping_isr();
+      // Ticks until the next echo step is due
+      static uint32_t shaping_next_due();
+    #endif
+
     #if ENABLED(INTEGRATED_BABYSTEPPING)
       // The Babystepping ISR phase
       static uint32_t babystepping_isr();
@@ -493,6 +641,19 @@ class Stepper {
     // Check if the given block is busy or not - Must not be called from ISR contexts
     static bool is_block_busy(const block_t * const block);
 
+    #if HAS_SHAPING
+      // Step echoes are still pending
+      static bool input_shaping_busy() {
+        return TERN0(INPUT_SHAPING_X, !shaping_queue_x.empty()) || TERN0(INPUT_SHAPING_Y, !shaping_queue_y.empty());
+      }
+      static void set_shaping_frequency(const AxisEnum axis, const float freq);
+      static float get_shaping_frequency(const AxisEnum axis);
+      static void set_shaping_damping_ratio(const AxisEnum axis, const float zeta);
+      static float get_shaping_damping_ratio(const AxisEnum axis);
+      static void set_shaping_type(const AxisEnum axis, const ShaperType type);
+      static ShaperType get_shaping_type(const AxisEnum axis);
+    #endif
+
     // Get the position of a stepper, in steps
     static int32_t position(const AxisEnum axis);
 
@@ -641,6 +802,19 @@ class Stepper {
       static int32_t _eval_bezier_curve(const uint32_t curr_step);
     #endif
 
+    #if ENABLED(STEP_EVENT_QUEUE)
+      static uint16_t next_step_event(const uint16_t i) { return (i + 1) & (STEP_EVENT_QUEUE_SIZE - 1); }
+      static uint16_t step_events_free() { return (step_event_tail - step_event_head - 1) & (STEP_EVENT_QUEUE_SIZE - 1); }
+      static void produce_step_events();
+      static void discard_step_events();
+      static void apply_step_event_dirs(const axis_bits_t bits);
+    #endif
+
+    #if HAS_SHAPING
+      static ShapeParams& shaping_params(const AxisEnum axis);
+      static void refresh_shaping(const AxisEnum axis);
+    #endif
+
     #if HAS_MOTOR_CURRENT_SPI || HAS_MOTOR_CURRENT_PWM
       static void digipot_init();
     #endif
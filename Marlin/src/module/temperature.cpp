@@ -1899,6 +1899,9 @@ void Temperature::task() {
    */
   TERN_(FILAMENT_WIDTH_SENSOR, filwidth.update_volumetric());
 
+  // Scale the volumetric extrusion limits by the melt capacity of each hotend
+  TERN_(VOLUMETRIC_LIMIT_BY_TEMP, planner.update_volumetric_extruder_limits());
+
   // Handle Bed Temp Errors, Heating Watch, etc.
   TERN_(HAS_HEATED_BED, manage_heated_bed(ms));
 
@@ -90,6 +90,15 @@
   #define Z_MIN_PROBE_PIN                     32
 #endif
 
+//
+// Bed Distance Sensor (simulated)
+//
+#if ENABLED(BD_SENSOR)
+  #define I2C_BD_SDA_PIN                      20
+  #define I2C_BD_SCL_PIN                      21
+  #define I2C_BD_DELAY                        10  // (seconds)
+#endif
+
 //
 // Steppers
 //
@@ -77,11 +77,11 @@ bool SdBaseFile::addDirCluster() {
   vol_->cacheSetBlockNumber(block, true);
 
   // zero first block of cluster
-  memset(vol_->cacheBuffer_.data, 0, 512);
+  memset(vol_->cache()->data, 0, 512);
 
   // zero rest of cluster
   for (uint8_t i = 1; i < vol_->blocksPerCluster_; i++) {
-    if (!vol_->writeBlock(block + i, vol_->cacheBuffer_.data)) return false;
+    if (!vol_->writeBlock(block + i, vol_->cache()->data)) return false;
   }
   // Increase directory file size by cluster size
   fileSize_ += 512UL << vol_->clusterSizeShift_;
@@ -1205,7 +1205,7 @@ bool SdBaseFile::openParent(SdBaseFile *dir) {
   // first block of parent dir
   if (!vol_->cacheRawBlock(lbn, SdVolume::CACHE_FOR_READ)) return false;
 
-  dir_t *p = &vol_->cacheBuffer_.dir[1];
+  dir_t *p = &vol_->cache()->dir[1];
   // verify name for '../..'
   if (p->name[0] != '.' || p->name[1] != '.') return false;
   // '..' is pointer to first cluster of parent. open '../..' to find parent
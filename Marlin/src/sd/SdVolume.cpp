@@ -39,11 +39,19 @@
 
 #if !USE_MULTIPLE_CARDS
   // raw block cache
-  uint32_t SdVolume::cacheBlockNumber_;  // current block number
-  cache_t  SdVolume::cacheBuffer_;       // 512 byte cache for Sd2Card
+  #if ENABLED(SD_BLOCK_CACHE)
+    uint32_t SdVolume::cacheBlockNumber_[SD_CACHE_BLOCKS];  // block number in each cache
+    cache_t  SdVolume::cacheBuffer_[SD_CACHE_BLOCKS];       // 512 byte caches for Sd2Card
+    bool     SdVolume::cacheDirty_[SD_CACHE_BLOCKS];        // cacheFlush() will write block if true
+    uint8_t  SdVolume::cacheAge_[SD_CACHE_BLOCKS],          // lookups since each cache was used
+             SdVolume::cacheCurrent_;                       // cache used by the last lookup
+  #else
+    uint32_t SdVolume::cacheBlockNumber_;  // current block number
+    cache_t  SdVolume::cacheBuffer_;       // 512 byte cache for Sd2Card
+    bool     SdVolume::cacheDirty_;        // cacheFlush() will write block if true
+    uint32_t SdVolume::cacheMirrorBlock_;  // mirror  block for second FAT
+  #endif
   DiskIODriver *SdVolume::sdCard_;       // pointer to SD card object
-  bool     SdVolume::cacheDirty_;        // cacheFlush() will write block if true
-  uint32_t SdVolume::cacheMirrorBlock_;  // mirror  block for second FAT
 #endif
 
 // find a contiguous group of clusters
@@ -120,6 +128,108 @@ bool SdVolume::allocContiguous(uint32_t count, uint32_t *curCluster) {
   return true;
 }
 
+#if ENABLED(SD_BLOCK_CACHE)
+
+// Write a changed block to the card, and to the second FAT for a block of the first FAT
+bool SdVolume::cacheWriteBack(const uint8_t i) {
+  #if DISABLED(SDCARD_READONLY)
+    if (cacheDirty_[i]) {
+      const uint32_t block = cacheBlockNumber_[i];
+      if (!sdCard_->writeBlock(block, cacheBuffer_[i].data)) return false;
+
+      // mirror FAT tables
+      if (fatCount_ > 1 && block >= fatStartBlock_ && block - fatStartBlock_ < blocksPerFat_) {
+        if (!sdCard_->writeBlock(block + blocksPerFat_, cacheBuffer_[i].data))
+          return false;
+      }
+      cacheDirty_[i] = false;
+    }
+  #endif
+  return true;
+}
+
+// Forget a cached block without writing it
+void SdVolume::cacheDrop(const uint8_t i) {
+  cacheBlockNumber_[i] = 0xFFFFFFFF;
+  cacheDirty_[i] = false;
+  cacheAge_[i] = 0xFF;
+}
+
+bool SdVolume::cacheFlush() {
+  for (uint8_t i = 0; i < SD_CACHE_BLOCKS; i++)
+    if (!cacheWriteBack(i)) return false;
+  return true;
+}
+
+/**
+ * Make the cache holding a block current. If no cache holds it make the least
+ * recently used FAT or data cache current, according to the block, and return false.
+ */
+bool SdVolume::cacheFind(const uint32_t blockNumber) {
+  uint8_t i = 0;
+  while (i < SD_CACHE_BLOCKS && cacheBlockNumber_[i] != blockNumber) i++;
+  const bool found = i < SD_CACHE_BLOCKS;
+  if (!found) {
+    const bool fat = isFatBlock(blockNumber);
+    const uint8_t first = fat ? 0 : SD_CACHE_FAT_BLOCKS, last = fat ? SD_CACHE_FAT_BLOCKS : SD_CACHE_BLOCKS;
+    i = first;
+    for (uint8_t j = first + 1; j < last; j++)
+      if (cacheAge_[j] > cacheAge_[i]) i = j;
+  }
+
+  // age the other caches in the same group
+  const bool fat = i < SD_CACHE_FAT_BLOCKS;
+  const uint8_t first = fat ? 0 : SD_CACHE_FAT_BLOCKS, last = fat ? SD_CACHE_FAT_BLOCKS : SD_CACHE_BLOCKS;
+  for (uint8_t j = first; j < last; j++)
+    if (cacheAge_[j] < 0xFF) cacheAge_[j]++;
+  cacheAge_[i] = 0;
+
+  cacheCurrent_ = i;
+  return found;
+}
+
+bool SdVolume::cacheRawBlock(uint32_t blockNumber, bool dirty) {
+  if (cacheBlockNumber_[cacheCurrent_] != blockNumber && !cacheFind(blockNumber)) {
+    if (!cacheWriteBack(cacheCurrent_)) return false;
+    cacheDrop(cacheCurrent_);
+    if (!sdCard_->readBlock(blockNumber, cacheBuffer_[cacheCurrent_].data)) return false;
+    cacheBlockNumber_[cacheCurrent_] = blockNumber;
+    cacheAge_[cacheCurrent_] = 0;
+  }
+  if (dirty) cacheDirty_[cacheCurrent_] = true;
+  return true;
+}
+
+// Callers flush the cache first, so the replaced block is never dirty
+void SdVolume::cacheSetBlockNumber(uint32_t blockNumber, bool dirty) {
+  if (blockNumber == 0xFFFFFFFF) {
+    cacheDrop(cacheCurrent_);
+    return;
+  }
+  cacheFind(blockNumber);
+  cacheDirty_[cacheCurrent_] = dirty;
+  cacheBlockNumber_[cacheCurrent_] = blockNumber;
+}
+
+// Read a block from the cache if it's there, so unwritten changes are seen
+bool SdVolume::readBlock(uint32_t block, uint8_t *dst) {
+  for (uint8_t i = 0; i < SD_CACHE_BLOCKS; i++)
+    if (cacheBlockNumber_[i] == block) {
+      memcpy(dst, cacheBuffer_[i].data, 512);
+      return true;
+    }
+  return sdCard_->readBlock(block, dst);
+}
+
+// Forget other cached copies of a block written directly to the card
+bool SdVolume::writeBlock(uint32_t block, const uint8_t *dst) {
+  for (uint8_t i = 0; i < SD_CACHE_BLOCKS; i++)
+    if (cacheBlockNumber_[i] == block && cacheBuffer_[i].data != dst) cacheDrop(i);
+  return sdCard_->writeBlock(block, dst);
+}
+
+#else // !SD_BLOCK_CACHE
+
 bool SdVolume::cacheFlush() {
   #if DISABLED(SDCARD_READONLY)
     if (cacheDirty_) {
@@ -148,6 +258,8 @@ bool SdVolume::cacheRawBlock(uint32_t blockNumber, bool dirty) {
   return true;
 }
 
+#endif // !SD_BLOCK_CACHE
+
 // return the size in bytes of a cluster chain
 bool SdVolume::chainSize(uint32_t cluster, uint32_t *size) {
   uint32_t s = 0;
@@ -169,13 +281,13 @@ bool SdVolume::fatGet(uint32_t cluster, uint32_t *value) {
     lba = fatStartBlock_ + (index >> 9);
     if (!cacheRawBlock(lba, CACHE_FOR_READ)) return false;
     index &= 0x1FF;
-    uint16_t tmp = cacheBuffer_.data[index];
+    uint16_t tmp = cache()->data[index];
     index++;
     if (index == 512) {
       if (!cacheRawBlock(lba + 1, CACHE_FOR_READ)) return false;
       index = 0;
     }
-    tmp |= cacheBuffer_.data[index] << 8;
+    tmp |= cache()->data[index] << 8;
     *value = cluster & 1 ? tmp >> 4 : tmp & 0xFFF;
     return true;
   }
@@ -187,10 +299,10 @@ bool SdVolume::fatGet(uint32_t cluster, uint32_t *value) {
   else
     return false;
 
-  if (lba != cacheBlockNumber_ && !cacheRawBlock(lba, CACHE_FOR_READ))
+  if (lba != cacheBlockNumber() && !cacheRawBlock(lba, CACHE_FOR_READ))
     return false;
 
-  *value = (fatType_ == 16) ? cacheBuffer_.fat16[cluster & 0xFF] : (cacheBuffer_.fat32[cluster & 0x7F] & FAT32MASK);
+  *value = (fatType_ == 16) ? cache()->fat16[cluster & 0xFF] : (cache()->fat32[cluster & 0x7F] & FAT32MASK);
   return true;
 }
 
@@ -211,26 +323,26 @@ bool SdVolume::fatPut(uint32_t cluster, uint32_t value) {
     lba = fatStartBlock_ + (index >> 9);
     if (!cacheRawBlock(lba, CACHE_FOR_WRITE)) return false;
     // mirror second FAT
-    if (fatCount_ > 1) cacheMirrorBlock_ = lba + blocksPerFat_;
+    IF_DISABLED(SD_BLOCK_CACHE, if (fatCount_ > 1) cacheMirrorBlock_ = lba + blocksPerFat_);
     index &= 0x1FF;
     uint8_t tmp = value;
     if (cluster & 1) {
-      tmp = (cacheBuffer_.data[index] & 0xF) | tmp << 4;
+      tmp = (cache()->data[index] & 0xF) | tmp << 4;
     }
-    cacheBuffer_.data[index] = tmp;
+    cache()->data[index] = tmp;
     index++;
     if (index == 512) {
       lba++;
       index = 0;
       if (!cacheRawBlock(lba, CACHE_FOR_WRITE)) return false;
       // mirror second FAT
-      if (fatCount_ > 1) cacheMirrorBlock_ = lba + blocksPerFat_;
+      IF_DISABLED(SD_BLOCK_CACHE, if (fatCount_ > 1) cacheMirrorBlock_ = lba + blocksPerFat_);
     }
     tmp = value >> 4;
     if (!(cluster & 1)) {
-      tmp = ((cacheBuffer_.data[index] & 0xF0)) | tmp >> 4;
+      tmp = ((cache()->data[index] & 0xF0)) | tmp >> 4;
     }
-    cacheBuffer_.data[index] = tmp;
+    cache()->data[index] = tmp;
     return true;
   }
 
@@ -245,12 +357,12 @@ bool SdVolume::fatPut(uint32_t cluster, uint32_t value) {
 
   // store entry
   if (fatType_ == 16)
-    cacheBuffer_.fat16[cluster & 0xFF] = value;
+    cache()->fat16[cluster & 0xFF] = value;
   else
-    cacheBuffer_.fat32[cluster & 0x7F] = value;
+    cache()->fat32[cluster & 0x7F] = value;
 
   // mirror second FAT
-  if (fatCount_ > 1) cacheMirrorBlock_ = lba + blocksPerFat_;
+  IF_DISABLED(SD_BLOCK_CACHE, if (fatCount_ > 1) cacheMirrorBlock_ = lba + blocksPerFat_);
   return true;
 }
 
@@ -293,11 +405,11 @@ int32_t SdVolume::freeClusterCount() {
     NOMORE(n, todo);
     if (fatType_ == 16) {
       for (uint16_t i = 0; i < n; i++)
-        if (cacheBuffer_.fat16[i] == 0) free++;
+        if (cache()->fat16[i] == 0) free++;
     }
     else {
       for (uint16_t i = 0; i < n; i++)
-        if (cacheBuffer_.fat32[i] == 0) free++;
+        if (cache()->fat32[i] == 0) free++;
     }
     #ifdef ESP32
       // Needed to reset the idle task watchdog timer on ESP32 as reading the complete FAT may easily
@@ -333,22 +445,27 @@ bool SdVolume::init(DiskIODriver* dev, uint8_t part) {
   sdCard_ = dev;
   fatType_ = 0;
   allocSearchStart_ = 2;
-  cacheDirty_ = 0;  // cacheFlush() will write block if true
-  cacheMirrorBlock_ = 0;
-  cacheBlockNumber_ = 0xFFFFFFFF;
+  #if ENABLED(SD_BLOCK_CACHE)
+    for (uint8_t i = 0; i < SD_CACHE_BLOCKS; i++) cacheDrop(i);
+    cacheCurrent_ = 0;
+  #else
+    cacheDirty_ = 0;  // cacheFlush() will write block if true
+    cacheMirrorBlock_ = 0;
+    cacheBlockNumber_ = 0xFFFFFFFF;
+  #endif
 
   // if part == 0 assume super floppy with FAT boot sector in block zero
   // if part > 0 assume mbr volume with partition table
   if (part) {
     if (part > 4) return false;
     if (!cacheRawBlock(volumeStartBlock, CACHE_FOR_READ)) return false;
-    part_t *p = &cacheBuffer_.mbr.part[part - 1];
+    part_t *p = &cache()->mbr.part[part - 1];
     if ((p->boot & 0x7F) != 0  || p->totalSectors < 100 || p->firstSector == 0)
       return false; // not a valid partition
     volumeStartBlock = p->firstSector;
   }
   if (!cacheRawBlock(volumeStartBlock, CACHE_FOR_READ)) return false;
-  fbs = &cacheBuffer_.fbs32;
+  fbs = &cache()->fbs32;
   if (fbs->bytesPerSector != 512 ||
       fbs->fatCount == 0 ||
       fbs->reservedSectorCount == 0 ||
@@ -53,6 +53,10 @@
 /**
  * \brief Cache for an SD data block
  */
+#if ENABLED(SD_BLOCK_CACHE)
+  #define SD_CACHE_BLOCKS ((SD_CACHE_FAT_BLOCKS) + (SD_CACHE_DATA_BLOCKS))
+#endif
+
 union cache_t {
   uint8_t         data[512];  // Used to access cached file data blocks.
   uint16_t        fat16[256]; // Used to access cached FAT16 entries.
@@ -79,8 +83,12 @@ class SdVolume {
    */
   cache_t* cacheClear() {
     if (!cacheFlush()) return 0;
-    cacheBlockNumber_ = 0xFFFFFFFF;
-    return &cacheBuffer_;
+    #if ENABLED(SD_BLOCK_CACHE)
+      cacheBlockNumber_[cacheCurrent_] = 0xFFFFFFFF;
+    #else
+      cacheBlockNumber_ = 0xFFFFFFFF;
+    #endif
+    return cache();
   }
 
   /**
@@ -139,17 +147,33 @@ class SdVolume {
   static bool const CACHE_FOR_WRITE = true;
 
   #if USE_MULTIPLE_CARDS
-    cache_t cacheBuffer_;        // 512 byte cache for device blocks
-    uint32_t cacheBlockNumber_;  // Logical number of block in the cache
+    #if ENABLED(SD_BLOCK_CACHE)
+      cache_t cacheBuffer_[SD_CACHE_BLOCKS];        // 512 byte caches for device blocks, FAT blocks first
+      uint32_t cacheBlockNumber_[SD_CACHE_BLOCKS];  // Logical number of block in each cache
+      bool cacheDirty_[SD_CACHE_BLOCKS];            // cacheFlush() will write block if true
+      uint8_t cacheAge_[SD_CACHE_BLOCKS];           // Lookups since each cache was used, for LRU replacement
+      uint8_t cacheCurrent_;                        // The cache used by the last lookup
+    #else
+      cache_t cacheBuffer_;        // 512 byte cache for device blocks
+      uint32_t cacheBlockNumber_;  // Logical number of block in the cache
+      bool cacheDirty_;            // cacheFlush() will write block if true
+      uint32_t cacheMirrorBlock_;  // block number for mirror FAT
+    #endif
     DiskIODriver *sdCard_;       // DiskIODriver object for cache
-    bool cacheDirty_;            // cacheFlush() will write block if true
-    uint32_t cacheMirrorBlock_;  // block number for mirror FAT
   #else
-    static cache_t cacheBuffer_;        // 512 byte cache for device blocks
-    static uint32_t cacheBlockNumber_;  // Logical number of block in the cache
+    #if ENABLED(SD_BLOCK_CACHE)
+      static cache_t cacheBuffer_[SD_CACHE_BLOCKS];       // 512 byte caches for device blocks, FAT blocks first
+      static uint32_t cacheBlockNumber_[SD_CACHE_BLOCKS]; // Logical number of block in each cache
+      static bool cacheDirty_[SD_CACHE_BLOCKS];           // cacheFlush() will write block if true
+      static uint8_t cacheAge_[SD_CACHE_BLOCKS];          // Lookups since each cache was used, for LRU replacement
+      static uint8_t cacheCurrent_;                       // The cache used by the last lookup
+    #else
+      static cache_t cacheBuffer_;        // 512 byte cache for device blocks
+      static uint32_t cacheBlockNumber_;  // Logical number of block in the cache
+      static bool cacheDirty_;            // cacheFlush() will write block if true
+      static uint32_t cacheMirrorBlock_;  // block number for mirror FAT
+    #endif
     static DiskIODriver *sdCard_;       // DiskIODriver object for cache
-    static bool cacheDirty_;            // cacheFlush() will write block if true
-    static uint32_t cacheMirrorBlock_;  // block number for mirror FAT
   #endif
 
   uint32_t allocSearchStart_;   // start cluster for alloc search
@@ -169,23 +193,44 @@ class SdVolume {
   uint32_t clusterStartBlock(uint32_t cluster) const { return dataStartBlock_ + ((cluster - 2) << clusterSizeShift_); }
   uint32_t blockNumber(uint32_t cluster, uint32_t position) const { return clusterStartBlock(cluster) + blockOfCluster(position); }
 
-  cache_t* cache() { return &cacheBuffer_; }
-  uint32_t cacheBlockNumber() const { return cacheBlockNumber_; }
+  #if ENABLED(SD_BLOCK_CACHE)
 
-  #if USE_MULTIPLE_CARDS
+    cache_t* cache() { return &cacheBuffer_[cacheCurrent_]; }
+    uint32_t cacheBlockNumber() const { return cacheBlockNumber_[cacheCurrent_]; }
+
+    // The FAT and data caches are replaced separately, so the FAT stays cached while reading
+    bool isFatBlock(const uint32_t block) const { return block >= fatStartBlock_ && block - fatStartBlock_ < fatCount_ * blocksPerFat_; }
+    bool cacheFind(const uint32_t blockNumber);
+    void cacheDrop(const uint8_t i);
+    bool cacheWriteBack(const uint8_t i);
     bool cacheFlush();
     bool cacheRawBlock(uint32_t blockNumber, bool dirty);
+
+    // used by SdBaseFile write to assign cache to SD location
+    void cacheSetBlockNumber(uint32_t blockNumber, bool dirty);
+    void cacheSetDirty() { cacheDirty_[cacheCurrent_] = true; }
+
   #else
-    static bool cacheFlush();
-    static bool cacheRawBlock(uint32_t blockNumber, bool dirty);
-  #endif
 
-  // used by SdBaseFile write to assign cache to SD location
-  void cacheSetBlockNumber(uint32_t blockNumber, bool dirty) {
-    cacheDirty_ = dirty;
-    cacheBlockNumber_  = blockNumber;
-  }
-  void cacheSetDirty() { cacheDirty_ |= CACHE_FOR_WRITE; }
+    cache_t* cache() { return &cacheBuffer_; }
+    uint32_t cacheBlockNumber() const { return cacheBlockNumber_; }
+
+    #if USE_MULTIPLE_CARDS
+      bool cacheFlush();
+      bool cacheRawBlock(uint32_t blockNumber, bool dirty);
+    #else
+      static bool cacheFlush();
+      static bool cacheRawBlock(uint32_t blockNumber, bool dirty);
+    #endif
+
+    // used by SdBaseFile write to assign cache to SD location
+    void cacheSetBlockNumber(uint32_t blockNumber, bool dirty) {
+      cacheDirty_ = dirty;
+      cacheBlockNumber_  = blockNumber;
+    }
+    void cacheSetDirty() { cacheDirty_ |= CACHE_FOR_WRITE; }
+
+  #endif
   bool chainSize(uint32_t beginCluster, uint32_t *size);
   bool fatGet(uint32_t cluster, uint32_t *value);
   bool fatPut(uint32_t cluster, uint32_t value);
@@ -196,6 +241,11 @@ class SdVolume {
     if (fatType_ == 16) return cluster >= FAT16EOC_MIN;
     return  cluster >= FAT32EOC_MIN;
   }
-  bool readBlock(uint32_t block, uint8_t *dst) { return sdCard_->readBlock(block, dst); }
-  bool writeBlock(uint32_t block, const uint8_t *dst) { return sdCard_->writeBlock(block, dst); }
+  #if ENABLED(SD_BLOCK_CACHE)
+    bool readBlock(uint32_t block, uint8_t *dst);
+    bool writeBlock(uint32_t block, const uint8_t *dst);
+  #else
+    bool readBlock(uint32_t block, uint8_t *dst) { return sdCard_->readBlock(block, dst); }
+    bool writeBlock(uint32_t block, const uint8_t *dst) { return sdCard_->writeBlock(block, dst); }
+  #endif
 };
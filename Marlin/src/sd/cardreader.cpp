@@ -55,6 +55,14 @@
   #include "../feature/pause.h"
 #endif
 
+#if ENABLED(ADAPTIVE_MESH)
+  #include "../feature/bedlevel/bedlevel.h"
+#endif
+
+#if ENABLED(MARLIN_TEST_BUILD) && EITHER(SD_READ_AHEAD, SD_BLOCK_CACHE)
+  #include "../tests/test_helpers.h"
+#endif
+
 #define DEBUG_OUT EITHER(DEBUG_CARDREADER, MARLIN_DEV_MODE)
 #include "../core/debug_out.h"
 #include "../libs/hex_print.h"
@@ -143,6 +151,11 @@ SdFile CardReader::file;
 
 uint32_t CardReader::filesize, CardReader::sdpos;
 
+#if ENABLED(SD_READ_AHEAD)
+  uint8_t CardReader::ra_buf[SD_READ_AHEAD_BLOCKS][512];
+  uint32_t CardReader::ra_start, CardReader::ra_end;
+#endif
+
 CardReader::CardReader() {
   changeMedia(&
     #if HAS_USB_FLASH_DRIVE && !SHARED_VOLUME_IS(SD_ONBOARD)
@@ -681,6 +694,7 @@ void CardReader::openFileRead(const char * const path, const uint8_t subcall_typ
   if (file.open(diveDir, fname, O_READ)) {
     filesize = file.fileSize();
     sdpos = 0;
+    TERN_(SD_READ_AHEAD, ra_start = ra_end = 0);
 
     { // Don't remove this block, as the PORT_REDIRECT is a RAII
       PORT_REDIRECT(SerialMask::All);
@@ -690,11 +704,98 @@ void CardReader::openFileRead(const char * const path, const uint8_t subcall_typ
 
     selectFileByName(fname);
     ui.set_status(longFilename[0] ? longFilename : fname);
+
+    TERN_(ADAPTIVE_MESH, if (!subcall_type) read_print_area());
   }
   else
     openFailed(fname);
 }
 
+#if ENABLED(ADAPTIVE_MESH)
+
+  /**
+   * Get the print area from the comments at the start of the file, as in
+   * the ;MINX: ;MINY: ;MAXX: ;MAXY: lines of a Cura header. A file without
+   * them clears the print area, so G29 probes the whole mesh.
+   */
+  void CardReader::read_print_area() {
+    print_area.reset();
+
+    xy_pos_t lo = { NAN, NAN }, hi = { NAN, NAN };
+    char line[24];
+    uint8_t len = 0;
+    for (uint16_t n = 0; n < 2048; ++n) {
+      const int16_t c = file.read();
+      if (c < 0) break;
+      if (c == '\n' || c == '\r') {
+        if (!len) continue;
+        if (line[0] != ';') break;              // End of the header
+        line[len] = '\0';
+        if (len > 6 && line[5] == ':' && (line[4] == 'X' || line[4] == 'Y')) {
+          const bool is_min = !strncmp_P(line, PSTR(";MIN"), 4),
+                     is_max = !strncmp_P(line, PSTR(";MAX"), 4);
+          if (is_min || is_max) {
+            xy_pos_t &p = is_min ? lo : hi;
+            p[line[4] == 'Y'] = strtof(&line[6], nullptr);
+          }
+        }
+        len = 0;
+      }
+      else if (len < sizeof(line) - 1)
+        line[len++] = c;
+    }
+    file.seekSet(0);
+
+    if (!isnan(lo.x) && !isnan(lo.y) && !isnan(hi.x) && !isnan(hi.y) && lo.x <= hi.x && lo.y <= hi.y) {
+      print_area.set(lo, hi);
+      SERIAL_ECHOLNPGM("Print area X", lo.x, ":", hi.x, " Y", lo.y, ":", hi.y);
+    }
+  }
+
+#endif // ADAPTIVE_MESH
+
+#if ENABLED(SD_READ_AHEAD)
+
+  /**
+   * Read the block holding sdpos after a seek or at the start of the file.
+   * Block-aligned reads go straight from the card into ra_buf.
+   */
+  bool CardReader::read_ahead_fill() {
+    ra_start = ra_end = sdpos & ~0x1FFUL;
+    return file.seekSet(ra_end) && read_ahead_block();
+  }
+
+  /**
+   * Read the block at ra_end, replacing the oldest block when the buffer is full.
+   * The file position is always ra_end while the buffer holds data.
+   */
+  bool CardReader::read_ahead_block() {
+    const int16_t n = file.read(ra_buf[(ra_end >> 9) & (SD_READ_AHEAD_BLOCKS - 1)], 512);
+    if (n <= 0) return false;
+    ra_end += n;
+    if (ra_end - ra_start > (SD_READ_AHEAD_BLOCKS) * 512UL) ra_start += 512;
+    return true;
+  }
+
+  /**
+   * Read the next block once the oldest one is used up. Called while the command
+   * queue is full, so blocks are usually ready before get() needs them.
+   */
+  void CardReader::read_ahead() {
+    if (ra_end == ra_start || (ra_end & 0x1FF) || ra_end >= filesize) return;
+    if (ra_end - ra_start < (SD_READ_AHEAD_BLOCKS) * 512UL || sdpos >= ra_start + 512)
+      read_ahead_block();
+  }
+
+  // Put the file position back at sdpos before reading around the buffer
+  void CardReader::read_ahead_stop() {
+    if (ra_end == ra_start) return;
+    ra_start = ra_end = 0;
+    file.seekSet(sdpos);
+  }
+
+#endif // SD_READ_AHEAD
+
 inline void echo_write_to_file(const char * const fname) {
   SERIAL_ECHOLNPGM(STR_SD_WRITE_TO_FILE, fname);
 }
@@ -1340,4 +1441,207 @@ void CardReader::fileHasFinished() {
 
 #endif // POWER_LOSS_RECOVERY
 
+#if BOTH(SD_READ_AHEAD, MARLIN_TEST_BUILD)
+
+  /**
+   * Read a G-code file one byte at a time and through the read-ahead buffer,
+   * checking that both give the same line positions and seeks, and comparing
+   * the lines per second of each. Run once media is mounted.
+   */
+  void test_sd_read_ahead() {
+    if (!test_result(F("SD read-ahead test media mounted"), card.isMounted())) return;
+
+    static const char test_file[] = "RATEST.GCO";
+
+    #if DISABLED(SDCARD_READONLY)
+      card.openFileWrite(test_file);
+      if (!test_result(F("SD read-ahead test file written"), card.isFileOpen())) return;
+      char line[48];
+      for (uint16_t i = 0; i < 5000; ++i) {
+        const int len = sprintf_P(line, PSTR("G1 X%u.%03u Y%u.%03u E%u.%05u\n"),
+                                  100 + i % 97, i * 7 % 1000, 80 + i % 89, i * 13 % 1000, i / 10, i * 37 % 100000);
+        card.write(line, len);
+      }
+      card.closefile();
+    #endif
+
+    card.openFileRead(test_file);
+    if (!test_result(F("SD read-ahead test file opened"), card.isFileOpen())) return;
+
+    // Count the lines, summing the position after each as saved for power-loss recovery
+    auto bytes_pass = [](uint32_t &pos_sum) -> uint32_t {
+      card.setIndex(0);
+      uint32_t lines = 0, pos = 0;
+      pos_sum = 0;
+      uint8_t c;
+      while (card.read(&c, 1) == 1) {
+        ++pos;
+        if (c == '\n') { ++lines; pos_sum += pos; }
+      }
+      return lines;
+    };
+    auto read_ahead_pass = [](uint32_t &pos_sum) -> uint32_t {
+      card.setIndex(0);
+      uint32_t lines = 0;
+      pos_sum = 0;
+      while (!card.eof()) {
+        const int16_t c = card.get();
+        if (c < 0) break;
+        if (c == '\n') { ++lines; pos_sum += card.getIndex(); card.read_ahead(); }
+      }
+      return lines;
+    };
+
+    uint32_t bytes_sum, read_ahead_sum;
+    const uint32_t bytes_lines = bytes_pass(bytes_sum), read_ahead_lines = read_ahead_pass(read_ahead_sum);
+    SERIAL_ECHOLNPGM("SD lines, byte reads: ", bytes_lines, " read-ahead: ", read_ahead_lines);
+    test_result(F("SD read-ahead line count"), bytes_lines == read_ahead_lines && bytes_lines > 0);
+    test_result(F("SD read-ahead line positions"), bytes_sum == read_ahead_sum);
+
+    // Seeks, as done by M26 and M808, must land on the same byte
+    uint16_t seeks = 0, missed = 0;
+    for (uint32_t p = 0; p < card.getFileSize(); p += 4093, ++seeks) {
+      card.setIndex(p);
+      const int16_t c = card.get();
+      bool same = card.getIndex() == p + 1;
+      card.setIndex(p);
+      uint8_t b;
+      same &= card.read(&b, 1) == 1 && c == b;
+      if (!same) ++missed;
+    }
+    SERIAL_ECHOLNPGM("SD read-ahead seeks: ", seeks, " missed: ", missed);
+    test_result(F("SD read-ahead seeks"), seeks && !missed);
+
+    // Read one line, starting over at the end of the file
+    auto byte_line = [](uint32_t) {
+      uint8_t c;
+      do {
+        if (card.read(&c, 1) != 1) { card.setIndex(0); return; }
+      } while (c != '\n');
+    };
+    auto read_ahead_line = [](uint32_t) {
+      if (card.eof()) card.setIndex(0);
+      int16_t c;
+      do { c = card.get(); } while (c >= 0 && c != '\n');
+      card.read_ahead();
+    };
+
+    card.setIndex(0);
+    const uint32_t byte_rate = test_calls_per_second(byte_line);
+    card.setIndex(0);
+    SERIAL_ECHOLNPGM("SD lines per second, byte reads: ", byte_rate, " read-ahead: ", test_calls_per_second(read_ahead_line));
+
+    card.closefile();
+    IF_DISABLED(SDCARD_READONLY, card.removeFile(test_file));
+  }
+
+#endif
+
+#if BOTH(SD_BLOCK_CACHE, MARLIN_TEST_BUILD)
+
+  // Pass block reads and writes through to the media, counting them
+  class CountingDiskIODriver : public DiskIODriver {
+    DiskIODriver * const media;
+  public:
+    uint32_t reads = 0, writes = 0;
+    CountingDiskIODriver(DiskIODriver * const d) : media(d) {}
+
+    bool init(const uint8_t sckRateID, const pin_t chipSelectPin) override { return media->init(sckRateID, chipSelectPin); }
+    bool readCSD(csd_t *csd)                                       override { return media->readCSD(csd); }
+
+    bool readStart(const uint32_t block)                           override { return media->readStart(block); }
+    bool readData(uint8_t *dst)                                    override { reads++; return media->readData(dst); }
+    bool readStop()                                                override { return media->readStop(); }
+
+    bool writeStart(const uint32_t block, const uint32_t count)    override { return media->writeStart(block, count); }
+    bool writeData(const uint8_t *src)                             override { writes++; return media->writeData(src); }
+    bool writeStop()                                               override { return media->writeStop(); }
+
+    bool readBlock(uint32_t block, uint8_t *dst)                   override { reads++; return media->readBlock(block, dst); }
+    bool writeBlock(uint32_t block, const uint8_t *src)            override { writes++; return media->writeBlock(block, src); }
+
+    uint32_t cardSize()                                            override { return media->cardSize(); }
+    bool isReady()                                                 override { return media->isReady(); }
+    void idle()                                                    override { media->idle(); }
+  };
+
+  /**
+   * Count the blocks read to list the working folder and open and start reading
+   * each file in it, as done when browsing the media menu and starting a print.
+   * Then check that a file written through the cache reads back from the media,
+   * with the second FAT matching the first. Run once media is mounted.
+   */
+  void test_sd_block_cache() {
+    if (!test_result(F("SD block cache test media mounted"), card.isMounted())) return;
+
+    DiskIODriver * const media = card.diskIODriver();
+    CountingDiskIODriver counter(media);
+    card.changeMedia(&counter);
+    card.mount();
+
+    if (test_result(F("SD block cache counted mount"), card.isMounted())) {
+      const uint32_t mount_reads = counter.reads;
+      counter.reads = 0;
+      const uint16_t count = card.get_num_Files();
+      for (uint16_t i = 0; i < count; i++) {
+        card.selectFileByIndex(i);
+        if (card.flag.filenameIsDir) continue;
+        char name[FILENAME_LENGTH];
+        strcpy(name, card.filename);              // Opening overwrites card.filename
+        card.openFileRead(name);
+        uint8_t head[64];
+        card.read(head, sizeof(head));
+        card.closefile();
+      }
+
+      SERIAL_ECHOLNPGM("SD blocks read to mount: ", mount_reads, ", to list, open and start reading ", count, " files: ", counter.reads,
+                       " (", SD_CACHE_FAT_BLOCKS, " FAT and ", SD_CACHE_DATA_BLOCKS, " data blocks cached)");
+
+      #if DISABLED(SDCARD_READONLY)
+        static const char test_file[] = "BCTEST.GCO";
+        constexpr uint16_t test_lines = 2000;   // Spans several clusters and FAT changes
+
+        card.cdroot();
+        card.openFileWrite(test_file);
+        if (test_result(F("SD block cache test file written"), card.isFileOpen())) {
+          char line[24];
+          for (uint16_t i = 0; i < test_lines; ++i) {
+            const int len = sprintf_P(line, PSTR("G1 X%u Y%u\n"), i, test_lines - i);
+            card.write(line, len);
+          }
+          card.closefile();
+
+          // Remount to drop the cache, so the file is read back from the media
+          card.mount();
+          card.openFileRead(test_file);
+          bool same = card.isFileOpen();
+          for (uint16_t i = 0; same && i < test_lines; ++i) {
+            char expect[24], got[24];
+            const int len = sprintf_P(expect, PSTR("G1 X%u Y%u\n"), i, test_lines - i);
+            same = card.read(got, len) == len && !memcmp(expect, got, len);
+          }
+          card.closefile();
+          test_result(F("SD block cache file read back"), same);
+
+          // Every FAT block written through the cache must be mirrored
+          const SdVolume &vol = CardReader::volume;
+          same = true;
+          if (vol.fatCount() > 1) {
+            uint8_t fat1[512], fat2[512];
+            for (uint32_t b = vol.fatStartBlock(); same && b < vol.fatStartBlock() + vol.blocksPerFat(); ++b)
+              same = media->readBlock(b, fat1) && media->readBlock(b + vol.blocksPerFat(), fat2) && !memcmp(fat1, fat2, 512);
+          }
+          test_result(F("SD block cache second FAT matches"), same);
+
+          card.removeFile(test_file);
+        }
+      #endif
+    }
+
+    card.changeMedia(media);
+    card.mount();
+  }
+
+#endif
+
 #endif // SDSUPPORT
@@ -236,10 +236,21 @@ public:
   static bool eof()              { return getIndex() >= getFileSize(); }
 
   // File data operations
-  static int16_t get()                            { int16_t out = (int16_t)file.read(); sdpos = file.curPosition(); return out; }
-  static int16_t read(void *buf, uint16_t nbyte)  { return file.isOpen() ? file.read(buf, nbyte) : -1; }
+  #if ENABLED(SD_READ_AHEAD)
+    static int16_t get() {
+      if ((sdpos < ra_start || sdpos >= ra_end) && !read_ahead_fill()) return -1;
+      const uint32_t i = sdpos++;
+      return ra_buf[(i >> 9) & (SD_READ_AHEAD_BLOCKS - 1)][i & 0x1FF];
+    }
+    static void read_ahead();
+    static int16_t read(void *buf, uint16_t nbyte)  { read_ahead_stop(); return file.isOpen() ? file.read(buf, nbyte) : -1; }
+    static void setIndex(const uint32_t index)      { ra_start = ra_end = 0; file.seekSet((sdpos = index)); }
+  #else
+    static int16_t get()                            { int16_t out = (int16_t)file.read(); sdpos = file.curPosition(); return out; }
+    static int16_t read(void *buf, uint16_t nbyte)  { return file.isOpen() ? file.read(buf, nbyte) : -1; }
+    static void setIndex(const uint32_t index)      { file.seekSet((sdpos = index)); }
+  #endif
   static int16_t write(void *buf, uint16_t nbyte) { return file.isOpen() ? file.write(buf, nbyte) : -1; }
-  static void setIndex(const uint32_t index)      { file.seekSet((sdpos = index)); }
 
   // TODO: rename to diskIODriver()
   static DiskIODriver* diskIODriver() { return driver; }
@@ -325,6 +336,10 @@ private:
 
   #endif // SDCARD_SORT_ALPHA
 
+  #if BOTH(SD_BLOCK_CACHE, MARLIN_TEST_BUILD)
+    friend void test_sd_block_cache();
+  #endif
+
   static DiskIODriver *driver;
   static SdVolume volume;
   static SdFile file;
@@ -332,6 +347,15 @@ private:
   static uint32_t filesize, // Total size of the current file, in bytes
                   sdpos;    // Index most recently read (one behind file.getPos)
 
+  #if ENABLED(SD_READ_AHEAD)
+    // STM32 (and others?) require a word-aligned buffer for SD card transfers via DMA
+    __attribute__((aligned(sizeof(size_t)))) static uint8_t ra_buf[SD_READ_AHEAD_BLOCKS][512];
+    static uint32_t ra_start, ra_end;     // The range of the file held in ra_buf
+    static bool read_ahead_fill();
+    static bool read_ahead_block();
+    static void read_ahead_stop();
+  #endif
+
   //
   // Procedure calls to other files
   //
@@ -358,6 +382,10 @@ private:
   #if ENABLED(SDCARD_SORT_ALPHA)
     static void flush_presort();
   #endif
+
+  #if ENABLED(ADAPTIVE_MESH)
+    static void read_print_area();
+  #endif
 };
 
 #if ENABLED(USB_FLASH_DRIVE_SUPPORT)
@@ -376,6 +404,13 @@ private:
 
 extern CardReader card;
 
+#if BOTH(SD_READ_AHEAD, MARLIN_TEST_BUILD)
+  void test_sd_read_ahead();
+#endif
+#if BOTH(SD_BLOCK_CACHE, MARLIN_TEST_BUILD)
+  void test_sd_block_cache();
+#endif
+
 #else // !SDSUPPORT
 
 #define IS_SD_PRINTING()  false
@@ -31,17 +31,50 @@
 #include "../module/stepper.h"
 #include "../module/temperature.h"
 
+#if ENABLED(BEZIER_CURVE_SUPPORT)
+  #include "../module/planner_bezier.h"
+#endif
+
+#if EITHER(ABL_BILINEAR_BICUBIC, UBL_CELL_CACHE)
+  #include "../feature/bedlevel/bedlevel.h"
+#endif
+
+#if EITHER(SD_READ_AHEAD, SD_BLOCK_CACHE)
+  #include "../sd/cardreader.h"
+#endif
+
+#if ENABLED(DELTA)
+  #include "../module/delta.h"
+#elif IS_SCARA
+  #include "../module/scara.h"
+#endif
+
 // Individual tests are localized in each module.
 // Each test produces its own report.
 
 // Startup tests are run at the end of setup()
 void runStartupTests() {
   // Call post-setup tests here to validate behaviors.
+  TERN_(BEZIER_CURVE_SUPPORT, test_bezier_segments());
+  TERN_(IS_SCARA, test_scara_ik());
+  TERN_(DELTA_CACHED_FK, test_delta_fk());
+  TERN_(ABL_BILINEAR_BICUBIC, test_bilinear_bicubic());
+  TERN_(UBL_CELL_CACHE, test_ubl_cell_cache());
 }
 
 // Periodic tests are run from within loop()
 void runPeriodicTests() {
   // Call periodic tests here to validate behaviors.
+
+  #if EITHER(SD_READ_AHEAD, SD_BLOCK_CACHE)
+    // Media is mounted by idle() after setup(), so test it once it's there
+    static bool sd_tested; // = false
+    if (!sd_tested && card.isMounted()) {
+      sd_tested = true;
+      TERN_(SD_READ_AHEAD, test_sd_read_ahead());
+      TERN_(SD_BLOCK_CACHE, test_sd_block_cache());
+    }
+  #endif
 }
 
 #endif // MARLIN_TEST_BUILD
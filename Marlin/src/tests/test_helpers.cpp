@@ -0,0 +1,48 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2022 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../inc/MarlinConfigPre.h"
+
+#if ENABLED(MARLIN_TEST_BUILD)
+
+#include "test_helpers.h"
+
+bool test_result(FSTR_P const name, const bool pass) {
+  SERIAL_ECHOF(name);
+  SERIAL_ECHOLNF(pass ? F(": PASS") : F(": FAIL"));
+  return pass;
+}
+
+bool test_max_error(FSTR_P const name, const_float_t error, const_float_t bound, FSTR_P const units) {
+  const bool pass = error <= bound;
+  SERIAL_ECHOF(name);
+  SERIAL_ECHOPGM(": ");
+  SERIAL_ECHO_F(error, 3);
+  SERIAL_ECHOF(units);
+  SERIAL_ECHOPGM(" (max ");
+  SERIAL_ECHO_F(bound, 3);
+  SERIAL_ECHOF(units);
+  SERIAL_ECHOLNF(pass ? F(") PASS") : F(") FAIL"));
+  return pass;
+}
+
+#endif // MARLIN_TEST_BUILD
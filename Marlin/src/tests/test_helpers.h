@@ -0,0 +1,47 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2022 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * Helpers for the MARLIN_TEST_BUILD module tests
+ */
+
+#include "../inc/MarlinConfig.h"
+
+// Call 'f(count)' with a running count for one second. Return the number of calls.
+// The clock is read every 256 calls, since it can cost more than a short call.
+template<typename F>
+uint32_t test_calls_per_second(F f) {
+  uint32_t count = 0;
+  const millis_t end_ms = millis() + 1000;
+  do f(count++); while ((count & 0xFF) || PENDING(millis(), end_ms));
+  return count;
+}
+
+// Keep a timed result, so the compiler can't drop the call that made it
+inline void test_keep(const float v) { static volatile float sink; sink = v; }
+
+// Print "<name>: PASS" or "<name>: FAIL" and return 'pass'
+bool test_result(FSTR_P const name, const bool pass);
+
+// Print "<name>: <error><units> (max <bound><units>) PASS" or "... FAIL" and return error <= bound
+bool test_max_error(FSTR_P const name, const_float_t error, const_float_t bound, FSTR_P const units);
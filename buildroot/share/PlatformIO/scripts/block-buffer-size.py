@@ -0,0 +1,37 @@
+#
+# block-buffer-size.py
+# Report the RAM used by the planner block buffer after linking
+#
+import pioutil
+if pioutil.is_pio_build():
+
+    import re, subprocess
+    from pathlib import Path
+    Import("env")
+
+    def report_block_buffer(target, source, env):
+        # Derive 'nm' from the toolchain's 'objcopy'
+        nm = re.sub(r'objcopy(\.exe)?$', r'nm\1', env.subst("$OBJCOPY"))
+        build = Path(env.subst("$BUILD_DIR"))
+        elf = build / env.subst("${PROGNAME}.elf")
+        if not elf.exists(): elf = build / env.subst("${PROGNAME}${PROGSUFFIX}")
+        try:
+            out = subprocess.run([nm, "-S", "-C", str(elf)], capture_output=True, text=True).stdout
+        except OSError:
+            return
+
+        for line in out.splitlines():
+            parts = line.split(maxsplit=3)
+            if len(parts) == 4 and parts[3] == "Planner::block_buffer":
+                total = int(parts[1], 16)
+                try:
+                    count = int(env['MARLIN_FEATURES']['BLOCK_BUFFER_SIZE'])
+                except (KeyError, ValueError):
+                    count = 0
+                if count > 0:
+                    print("Planner block buffer: %d x %d = %d bytes" % (count, total // count, total))
+                else:
+                    print("Planner block buffer: %d bytes" % total)
+                break
+
+    env.AddPostAction("buildprog", report_block_buffer)
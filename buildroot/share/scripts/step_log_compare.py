@@ -0,0 +1,171 @@
+#!/usr/bin/env python3
+#
+# step_log_compare.py
+#
+# Compare the step output of two runs of the Linux simulator, e.g., with the
+# trapezoid generator (M493 S0) and with Fixed-Time Motion (M493 S1).
+#
+# Build the Linux native target with FT_MOTION and STEP_LOGGING (see
+# HAL/LINUX/main.cpp). With --run the simulator is started twice in a scratch
+# folder, the same moves are sent with M493 S0 and then M493 S1, and the two
+# step logs are compared. Without --run, compare two axis_step_log.csv files
+# saved by hand.
+#
+# usage: step_log_compare.py --run <marlin binary> [moves.gcode] [max_deviation_steps]
+#        step_log_compare.py <reference.csv> <test.csv> [max_deviation_steps]
+#
+# The runs pass if their lengths are within 5%, every axis makes the same
+# number of steps and ends at the same position, and the path never strays
+# more than the given number of steps (default 10) from the reference. The
+# path is compared after the same number of steps of all axes, so it doesn't
+# depend on the simulator's timing.
+#
+# The timing deviation is only shown. For it, each run is aligned to its first
+# step and the test run is scaled to the length of the reference. The
+# simulator shares the CPU with its own threads, so two runs of the same
+# engine can differ by a hundred steps or more.
+#
+# Step timing jitter is also shown for each run, as the median and 99th
+# percentile change from one step interval to the next (ignoring stops).
+#
+# The exit status is 0 for PASS and 1 for FAIL, so it can be used in scripts.
+#
+import sys, bisect, os, queue, shutil, subprocess, tempfile, threading, time
+
+def load(path):
+    axes = {}
+    with open(path) as f:
+        for line in f:
+            parts = [p.strip() for p in line.split(',')]
+            if len(parts) != 3: continue
+            axes.setdefault(parts[1], []).append((int(parts[0]), int(parts[2])))
+    start = min(v[0][0] for v in axes.values()) if axes else 0
+    return { a: ([t - start for t, _ in v], [p for _, p in v]) for a, v in axes.items() }
+
+def position_at(track, t, before):
+    times, pos = track
+    i = bisect.bisect_right(times, t)
+    return pos[i - 1] if i else before
+
+def path_deviation(ref, test, axes):
+    """The largest difference on each axis after the same number of steps of all axes"""
+    events = lambda log: sorted((t, a, p) for a in axes for t, p in zip(*log[a]))
+    at_r, at_t = { a: ref[a][1][0] for a in axes }, { a: test[a][1][0] for a in axes }
+    r0, t0 = dict(at_r), dict(at_t)
+    worst = { a: 0 for a in axes }
+    for (_, ar, pr), (_, at, pt) in zip(events(ref), events(test)):
+        at_r[ar], at_t[at] = pr, pt
+        for a in (ar, at): worst[a] = max(worst[a], abs((at_r[a] - r0[a]) - (at_t[a] - t0[a])))
+    return worst
+
+def jitter(track):
+    times = track[0]
+    iv = [b - a for a, b in zip(times, times[1:])]
+    d = sorted(abs(b - a) for a, b in zip(iv, iv[1:]) if max(a, b) < 2000000)
+    return (d[len(d) // 2], d[len(d) * 99 // 100]) if d else (0, 0)
+
+# Moves sent with --run when no G-code file is given
+DEFAULT_MOVES = """
+M302 P1
+G92 X0 Y0 Z0 E0
+G1 X50 Y20 F6000
+G1 X80 Y60 E2 F3000
+G1 X20 Y80 Z1 E5 F4000
+G1 X60 Y40 F9000
+G1 X10 Y10 Z0 E6 F2400
+"""
+
+def run_engine(binary, moves, engine, folder, timeout=120):
+    """Send the moves to the simulator with M493 S<engine> and return its step log"""
+    done = "STEP LOG DONE"
+    cmd = ([ "stdbuf", "-o0" ] if shutil.which("stdbuf") else []) + [ os.path.abspath(binary) ]
+    sim = subprocess.Popen(cmd, cwd=folder, stdin=subprocess.PIPE, stdout=subprocess.PIPE,
+                           stderr=subprocess.DEVNULL, text=True, bufsize=1)
+    lines = [ "M493 S%d" % engine ] + [ l for l in moves.splitlines() if l.strip() ] + [ "M400", "M118 " + done ]
+    sim.stdin.write("\n".join(lines) + "\n")
+    sim.stdin.flush()
+    # Read on a thread, so a simulator that stops talking can't block the timeout
+    lines = queue.Queue()
+    threading.Thread(target=lambda: [ lines.put(l) for l in sim.stdout ], daemon=True).start()
+    end = time.time() + timeout
+    finished = False
+    while not finished and time.time() < end:
+        try: finished = done in lines.get(timeout=1)
+        except queue.Empty: pass
+    time.sleep(0.2)   # Let the simulation thread flush the last steps
+    sim.kill()
+    sim.wait()
+    if not finished:
+        print("engine %d: no '%s' within %d s" % (engine, done, timeout))
+        return None
+    step_log = os.path.join(folder, "axis_step_log.csv")
+    if not os.path.exists(step_log):
+        print("engine %d: no step log. Was the simulator built with STEP_LOGGING?" % engine)
+        return None
+    log = os.path.join(folder, "engine%d.csv" % engine)
+    os.replace(step_log, log)
+    return log
+
+def compare(ref_path, test_path, limit):
+    ref, test = load(ref_path), load(test_path)
+    ok = True
+
+    # Both runs are stretched to the same length, so a small difference in
+    # the velocity profile doesn't show up as a growing position error.
+    end = lambda log: max(v[0][-1] for v in log.values())
+    if not ref or not test:
+        print("no steps in %s" % ("reference" if not ref else "test"))
+        return False
+    scale = end(ref) / end(test) if end(test) else 1
+    print("duration %.1f / %.1f ms" % (end(ref) / 1e6, end(test) / 1e6))
+    if abs(1 - scale) > 0.05: ok = False
+
+    for axis in sorted(set(ref) ^ set(test)):
+        print("%s: only in %s" % (axis, "reference" if axis in ref else "test"))
+        ok = False
+
+    axes = sorted(set(ref) & set(test))
+    path = path_deviation(ref, test, axes)
+    for axis in axes:
+        r = ref[axis]
+        s = ([t * scale for t in test[axis][0]], test[axis][1])
+        r0, s0 = r[1][0], s[1][0]
+
+        # Sample both runs at every step time of either run
+        worst = 0
+        for t in sorted(set(r[0]) | set(s[0])):
+            worst = max(worst, abs((position_at(r, t, r0) - r0) - (position_at(s, t, s0) - s0)))
+
+        print("%s: steps %d / %d, travel %d / %d, path deviation %d steps, timing deviation %d steps"
+              % (axis, len(r[1]), len(s[1]), r[1][-1] - r0, s[1][-1] - s0, path[axis], worst))
+        print("%s: jitter median %.1f / %.1f us, 99%% %.1f / %.1f us"
+              % ((axis,) + tuple(v / 1000 for p in zip(jitter(r), jitter(test[axis])) for v in p)))
+        if len(r[1]) != len(s[1]) or r[1][-1] - r0 != s[1][-1] - s0 or path[axis] > limit: ok = False
+
+    return ok
+
+def main():
+    args = sys.argv[1:]
+    if len(args) < 2:
+        print(__doc__ or "usage: step_log_compare.py --run <marlin binary> [moves.gcode] [max_deviation_steps]\n"
+                         "       step_log_compare.py <reference.csv> <test.csv> [max_deviation_steps]")
+        return 2
+
+    limit = int(args.pop()) if len(args) > 2 and args[-1].isdigit() else 10
+
+    if args[0] == "--run":
+        moves = DEFAULT_MOVES
+        if len(args) > 2:
+            with open(args[2]) as f: moves = f.read()
+        folder = tempfile.mkdtemp(prefix="step_log_")   # The step logs are written to the working folder
+        ref, test = run_engine(args[1], moves, 0, folder), run_engine(args[1], moves, 1, folder)
+        ok = bool(ref and test) and compare(ref, test, limit)
+        shutil.rmtree(folder, ignore_errors=True)
+    else:
+        ok = compare(args[0], args[1], limit)
+
+    print("PASS" if ok else "FAIL")
+    return 0 if ok else 1
+
+if __name__ == '__main__':
+    sys.exit(main())